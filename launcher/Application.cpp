@@ -107,6 +107,7 @@
 #include <minecraft/auth/AccountList.h>
 #include "icons/IconList.h"
 #include "net/HttpMetaCache.h"
+#include "net/ResponseCache.h"
 
 #include "java/JavaInstallList.h"
 
@@ -855,7 +856,10 @@ Application::Application(int& argc, char** argv) : QApplication(argc, argv)
         m_instances.reset(new InstanceList(m_settings, instDir, this));
         connect(InstDirSetting.get(), &Setting::SettingChanged, m_instances.get(), &InstanceList::on_InstFolderChanged);
         qDebug() << "Loading Instances...";
-        m_instances->loadList();
+        if (!m_instances->loadSnapshot()) {
+            // the window shows up right away and the instances appear in it as they are read
+            m_instances->loadList(true);
+        }
         qDebug() << "<> Instances loaded.";
     }
 
@@ -887,6 +891,7 @@ Application::Application(int& argc, char** argv) : QApplication(argc, argv)
         m_metacache->addBase("meta", QDir("meta").absolutePath());
         m_metacache->addBase("java", QDir("cache/java").absolutePath());
         m_metacache->Load();
+        m_responseCache = std::make_shared<Net::ResponseCache>(QDir("cache/api").absolutePath());
         qDebug() << "<> Cache initialized.";
     }
 
@@ -914,6 +919,10 @@ Application::Application(int& argc, char** argv) : QApplication(argc, argv)
         if (m_instances) {
             // save any remaining instance state
             m_instances->saveNow();
+            m_instances->saveSnapshot();
+        }
+        if (m_settings) {
+            m_settings->saveNow();
         }
         if (logFile) {
             logFile->flush();
@@ -1666,6 +1675,11 @@ shared_qobject_ptr<HttpMetaCache> Application::metacache()
     return m_metacache;
 }
 
+std::shared_ptr<Net::ResponseCache> Application::responseCache()
+{
+    return m_responseCache;
+}
+
 shared_qobject_ptr<QNetworkAccessManager> Application::network()
 {
     return m_network;
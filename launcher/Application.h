@@ -77,6 +77,10 @@ namespace Meta {
 class Index;
 }
 
+namespace Net {
+class ResponseCache;
+}
+
 #if defined(APPLICATION)
 #undef APPLICATION
 #endif
@@ -144,6 +148,8 @@ class Application : public QApplication {
 
     shared_qobject_ptr<HttpMetaCache> metacache();
 
+    std::shared_ptr<Net::ResponseCache> responseCache();
+
     shared_qobject_ptr<Meta::Index> metadataIndex();
 
     void updateCapabilities();
@@ -244,6 +250,7 @@ class Application : public QApplication {
     shared_qobject_ptr<AccountList> m_accounts;
 
     shared_qobject_ptr<HttpMetaCache> m_metacache;
+    std::shared_ptr<Net::ResponseCache> m_responseCache;
     shared_qobject_ptr<Meta::Index> m_metadataIndex;
 
     std::shared_ptr<SettingsObject> m_settings;
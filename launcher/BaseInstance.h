@@ -49,6 +49,7 @@
 
 #include "BaseVersionList.h"
 #include "MessageLevel.h"
+#include "launch/LogLevelClassifier.h"
 #include "minecraft/auth/MinecraftAccount.h"
 #include "pathmatcher/IPathMatcher.h"
 #include "settings/INIFile.h"
@@ -148,8 +149,8 @@ class BaseInstance : public QObject, public std::enable_shared_from_this<BaseIns
     void setManagedPack(const QString& type, const QString& id, const QString& name, const QString& versionId, const QString& version);
     void copyManagedPack(BaseInstance& other);
 
-    /// guess log level from a line of game log
-    virtual MessageLevel::Enum guessLevel([[maybe_unused]] const QString& line, MessageLevel::Enum level) { return level; }
+    /// build the rules used to guess the log level of game log lines, called once per launch
+    virtual std::unique_ptr<LogLevelClassifier> createLogLevelClassifier() const { return std::make_unique<LogLevelClassifier>(); }
 
     virtual QStringList extraArguments();
 
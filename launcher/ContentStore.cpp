@@ -0,0 +1,216 @@
+// SPDX-License-Identifier: GPL-3.0-only
+/*
+ *  Prism Launcher - Minecraft Launcher
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, version 3.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "ContentStore.h"
+
+#include <QDateTime>
+#include <QDebug>
+#include <QDir>
+#include <QDirIterator>
+#include <QFile>
+#include <QFileInfo>
+
+#include "FileSystem.h"
+
+namespace ContentStore {
+
+static QString algorithmName(QCryptographicHash::Algorithm algorithm)
+{
+    switch (algorithm) {
+        case QCryptographicHash::Sha1:
+            return "sha1";
+        case QCryptographicHash::Sha256:
+            return "sha256";
+        case QCryptographicHash::Sha512:
+            return "sha512";
+        default:
+            // weaker hashes are not trusted to tell files of different instances apart
+            return {};
+    }
+}
+
+static QString root()
+{
+    return QDir("store").absolutePath();
+}
+
+// unused entries that could not be linked are kept this long after they were last placed
+static const qint64 s_unlinked_lifetime_days = 30;
+
+static const QFileDevice::Permissions s_read_only =
+    QFileDevice::ReadOwner | QFileDevice::ReadUser | QFileDevice::ReadGroup | QFileDevice::ReadOther;
+
+static bool isReadOnly(const QString& file)
+{
+    return !(QFile::permissions(file) & QFileDevice::WriteOwner);
+}
+
+enum class Placement { Failed, Cloned, Linked, Copied };
+
+// puts the contents of source at target, sharing the data on disk where the filesystem allows it
+static Placement place(const QString& source, const QString& target, bool allowCopy)
+{
+    const auto sourceInfo = FS::statFS(source);
+    const auto targetInfo = FS::statFS(target);
+    const bool sameDevice = sourceInfo.rootPath == targetInfo.rootPath;
+
+    // a reflink shares the data until either side is written to, which keeps the instance file independent
+    if (sameDevice && FS::canCloneOnFS(sourceInfo)) {
+        std::error_code err;
+        if (FS::clone_file(source, target, err))
+            return Placement::Cloned;
+    }
+    // a hard link shares the file itself, so it is made read-only to keep writes from reaching the store
+    if (sameDevice && FS::canLinkOnFS(sourceInfo)) {
+        FS::create_link link(source, target);
+        link.useHardLinks(true);
+        if (link() && QFile::setPermissions(target, s_read_only))
+            return Placement::Linked;
+        QFile::remove(target);
+    }
+    if (allowCopy && QFile::copy(source, target))
+        return Placement::Copied;
+    return Placement::Failed;
+}
+
+// keeps an entry that is not tracked by its links from being collected while it's in use
+static void touch(const QString& stored)
+{
+    if (isReadOnly(stored))
+        return;
+    QFile file(stored);
+    if (file.open(QFile::ReadWrite))
+        file.setFileTime(QDateTime::currentDateTime(), QFileDevice::FileModificationTime);
+}
+
+
+QString path(QCryptographicHash::Algorithm algorithm, const QByteArray& hash)
+{
+    const QString name = algorithmName(algorithm);
+    if (name.isEmpty() || hash.size() != QCryptographicHash::hashLength(algorithm))
+        return {};
+    const QString hex = hash.toHex();
+    return FS::PathCombine(root(), name, hex.left(2), hex);
+}
+
+bool isStorable(const QString& target)
+{
+    static const QStringList s_folders = { "mods", "resourcepacks", "shaderpacks" };
+    return s_folders.contains(QFileInfo(target).absoluteDir().dirName());
+}
+
+bool materialize(QCryptographicHash::Algorithm algorithm, const QByteArray& hash, const QString& target)
+{
+    const QString stored = path(algorithm, hash);
+    if (stored.isEmpty() || !QFileInfo::exists(stored))
+        return false;
+
+    // a damaged entry is dropped, so the file gets downloaded again
+    QFile file(stored);
+    QCryptographicHash actual(algorithm);
+    if (!file.open(QFile::ReadOnly) || !actual.addData(&file) || actual.result() != hash) {
+        qWarning() << "Stored file" << stored << "does not match its hash, removing it";
+        file.close();
+        FS::deletePath(stored);
+        return false;
+    }
+    file.close();
+
+    if (!FS::ensureFilePathExists(target))
+        return false;
+
+    // whatever is at the target stays untouched until the stored file has been placed next to it
+    const QString temporary = target + ".store";
+    QFile::remove(temporary);
+    if (place(stored, temporary, true) == Placement::Failed) {
+        qWarning() << "Could not place" << stored << "at" << target;
+        QFile::remove(temporary);
+        return false;
+    }
+    if ((QFileInfo::exists(target) && !FS::deletePath(target)) || !QFile::rename(temporary, target)) {
+        qWarning() << "Could not replace" << target << "with the stored file";
+        FS::deletePath(temporary);
+        return false;
+    }
+    touch(stored);
+    return true;
+}
+
+bool add(QCryptographicHash::Algorithm algorithm, const QByteArray& hash, const QString& file)
+{
+    const QString stored = path(algorithm, hash);
+    if (stored.isEmpty())
+        return false;
+
+    // another instance brought the same file already, share that one
+    if (QFileInfo::exists(stored))
+        return materialize(algorithm, hash, file);
+
+    if (!FS::ensureFilePathExists(stored))
+        return false;
+    // a copy would only double the disk use, so files that can't be shared stay out of the store
+    const QString temporary = stored + ".part";
+    QFile::remove(temporary);
+    if (place(file, temporary, false) == Placement::Failed || !QFile::rename(temporary, stored)) {
+        qDebug() << "Could not add" << file << "to the content store";
+        FS::deletePath(temporary);
+        return false;
+    }
+    touch(stored);
+    return true;
+}
+
+uintmax_t linkCount(const QString& file)
+{
+    const auto count = FS::hardLinkCount(file);
+    // store entries are only hard linked once made read-only, so one of the links of such a file is the store's
+    if (count > 1 && isReadOnly(file))
+        return count - 1;
+    return count;
+}
+
+GarbageCollection collectGarbage()
+{
+    GarbageCollection result;
+    const auto expiry = QDateTime::currentDateTime().addDays(-s_unlinked_lifetime_days);
+    QDirIterator iter(root(), QDir::Files | QDir::Hidden, QDirIterator::Subdirectories);
+    while (iter.hasNext()) {
+        const QString file = iter.next();
+        bool unused;
+        if (file.endsWith(".part")) {
+            // leftovers of interrupted additions
+            unused = true;
+        } else if (isReadOnly(file)) {
+            // hard linked entries are unused once the store holds their only link
+            unused = FS::hardLinkCount(file) == 1;
+        } else {
+            // cloned entries don't know their users, so they go once they haven't been placed for a while
+            unused = iter.fileInfo().lastModified() < expiry;
+        }
+        if (!unused)
+            continue;
+        const qint64 size = iter.fileInfo().size();
+        if (FS::deletePath(file)) {
+            result.removedFiles++;
+            result.freedBytes += size;
+        }
+    }
+    qDebug() << "Removed" << result.removedFiles << "unused files from the content store";
+    return result;
+}
+
+}  // namespace ContentStore
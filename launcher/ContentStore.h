@@ -0,0 +1,64 @@
+// SPDX-License-Identifier: GPL-3.0-only
+/*
+ *  Prism Launcher - Minecraft Launcher
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, version 3.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <QByteArray>
+#include <QCryptographicHash>
+#include <QString>
+
+#include <cstdint>
+
+/**
+ * Launcher-wide store of downloaded resources, addressed by the hash the platform APIs publish for them.
+ *
+ * Instance files are reflinks of the stored files where the filesystem supports them, or read-only hard links otherwise,
+ * so a file shared by many instances is only downloaded and kept on disk once. Files that can be neither are not stored.
+ * Only mods, resource packs and shader packs go through the store; anything that may be edited in place stays out of it.
+ */
+namespace ContentStore {
+
+/** Path of the stored file with the given hash, or an empty string if the hash can't address the store. */
+QString path(QCryptographicHash::Algorithm algorithm, const QByteArray& hash);
+
+/** Whether a file at target may be shared through the store. */
+bool isStorable(const QString& target);
+
+/**
+ * Places the stored file at target, as a reflink, a hard link or a copy.
+ * Returns false if it's not in the store, or if the stored file no longer matches its hash.
+ */
+bool materialize(QCryptographicHash::Algorithm algorithm, const QByteArray& hash, const QString& target);
+
+/** Adds a file that has been verified to have the given hash to the store. */
+bool add(QCryptographicHash::Algorithm algorithm, const QByteArray& hash, const QString& file);
+
+struct GarbageCollection {
+    int removedFiles = 0;
+    qint64 freedBytes = 0;
+};
+
+/** Hard link count of a file, not counting the link the store holds to it. */
+uintmax_t linkCount(const QString& file);
+
+/**
+ * Removes the stored files no instance uses anymore.
+ * Hard linked files are unused once the store holds their only link; reflinked files once they haven't been placed for a month.
+ */
+GarbageCollection collectGarbage();
+
+}  // namespace ContentStore
@@ -680,10 +680,63 @@ bool move(const QString& source, const QString& dest)
     return true;
 }
 
+#if defined Q_OS_WIN32
+// removes a read-only file, leaving the attribute set for the other hard links of it
+static bool removeReadOnlyLink(const std::wstring& path)
+{
+    const DWORD access = DELETE | FILE_READ_ATTRIBUTES | FILE_WRITE_ATTRIBUTES;
+    const DWORD share = FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE;
+    HANDLE handle = CreateFileW(path.c_str(), access, share, nullptr, OPEN_EXISTING, FILE_FLAG_OPEN_REPARSE_POINT, nullptr);
+    if (handle == INVALID_HANDLE_VALUE)
+        return false;
+
+    bool removed = false;
+    FILE_BASIC_INFO info{};
+    if (GetFileInformationByHandleEx(handle, FileBasicInfo, &info, sizeof(info))) {
+        const DWORD attributes = info.FileAttributes;
+        // zeroed fields are left as they are
+        info.CreationTime.QuadPart = info.LastAccessTime.QuadPart = info.LastWriteTime.QuadPart = info.ChangeTime.QuadPart = 0;
+        info.FileAttributes = (attributes & ~FILE_ATTRIBUTE_READONLY) ? (attributes & ~FILE_ATTRIBUTE_READONLY) : FILE_ATTRIBUTE_NORMAL;
+        if (SetFileInformationByHandle(handle, FileBasicInfo, &info, sizeof(info))) {
+            FILE_DISPOSITION_INFO disposition{ TRUE };
+            removed = SetFileInformationByHandle(handle, FileDispositionInfo, &disposition, sizeof(disposition));
+            // the attribute belongs to the file rather than the link, the link only goes away once the handle is closed
+            info.FileAttributes = attributes;
+            if (!SetFileInformationByHandle(handle, FileBasicInfo, &info, sizeof(info)))
+                qWarning() << "Could not restore the attributes of" << QString::fromStdWString(path);
+        }
+    }
+    CloseHandle(handle);
+    return removed;
+}
+
+// Windows refuses to remove read-only files, like the hard links shared with the content store
+static void removeReadOnlyFiles(const QString& path)
+{
+    const auto native = QDir::toNativeSeparators(path).toStdWString();
+    const DWORD attributes = GetFileAttributesW(native.c_str());
+    if (attributes == INVALID_FILE_ATTRIBUTES)
+        return;
+    if (!(attributes & FILE_ATTRIBUTE_DIRECTORY)) {
+        if (attributes & FILE_ATTRIBUTE_READONLY)
+            removeReadOnlyLink(native);
+        return;
+    }
+    // links and junctions are removed themselves, what they point to is left alone
+    if (attributes & FILE_ATTRIBUTE_REPARSE_POINT)
+        return;
+    for (auto& entry : QDir(path).entryList(QDir::AllEntries | QDir::NoDotAndDotDot | QDir::Hidden | QDir::System))
+        removeReadOnlyFiles(PathCombine(path, entry));
+}
+#endif
+
 bool deletePath(QString path)
 {
     std::error_code err;
 
+#if defined Q_OS_WIN32
+    removeReadOnlyFiles(path);
+#endif
     fs::remove_all(StringUtils::toStdString(path), err);
 
     if (err) {
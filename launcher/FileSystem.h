@@ -288,6 +288,7 @@ bool move(const QString& source, const QString& dest);
 
 /**
  * Delete a folder recursively
+ * Read-only files are removed too, without dropping the attribute from other hard links of them
  */
 bool deletePath(QString path);
 
@@ -37,6 +37,8 @@
 #include <zlib.h>
 #include <QByteArray>
 
+#include <limits>
+
 bool GZip::unzip(const QByteArray& compressedBytes, QByteArray& uncompressedBytes)
 {
     if (compressedBytes.size() == 0) {
@@ -136,3 +138,239 @@ bool GZip::zip(const QByteArray& uncompressedBytes, QByteArray& compressedBytes)
     }
     return true;
 }
+
+namespace {
+// size of the bounded compressed-side buffers used by the streaming devices
+constexpr int streamChunkSize = 64 * 1024;
+}  // namespace
+
+GZipReader::GZipReader(QIODevice* source, QObject* parent) : QIODevice(parent), m_source(source)
+{
+    memset(&m_stream, 0, sizeof(m_stream));
+}
+
+GZipReader::~GZipReader()
+{
+    if (m_initialized) {
+        inflateEnd(&m_stream);
+    }
+}
+
+bool GZipReader::open(OpenMode mode)
+{
+    if ((mode & QIODevice::ReadWrite) != QIODevice::ReadOnly) {
+        setErrorString(tr("GZipReader can only be opened for reading"));
+        return false;
+    }
+    if (!m_source || !m_source->isReadable()) {
+        setErrorString(tr("The compressed source is not readable"));
+        return false;
+    }
+    if (m_initialized) {
+        inflateEnd(&m_stream);
+    }
+    memset(&m_stream, 0, sizeof(m_stream));
+    if (inflateInit2(&m_stream, (16 + MAX_WBITS)) != Z_OK) {
+        m_initialized = false;
+        setErrorString(tr("Unable to initialize the gzip decompressor"));
+        return false;
+    }
+    m_initialized = true;
+    m_sourceDrained = false;
+    m_finished = false;
+    m_inBuffer.resize(streamChunkSize);
+    return QIODevice::open(mode | QIODevice::Unbuffered);
+}
+
+void GZipReader::close()
+{
+    QIODevice::close();
+    if (m_initialized) {
+        inflateEnd(&m_stream);
+        m_initialized = false;
+    }
+    m_inBuffer.clear();
+    m_inBuffer.squeeze();
+}
+
+bool GZipReader::atEnd() const
+{
+    return m_finished && QIODevice::bytesAvailable() == 0;
+}
+
+bool GZipReader::fillInput()
+{
+    auto read = m_source->read(m_inBuffer.data(), m_inBuffer.size());
+    if (read < 0) {
+        setErrorString(m_source->errorString());
+        return false;
+    }
+    if (read == 0 && m_source->atEnd()) {
+        m_sourceDrained = true;
+    }
+    m_stream.next_in = reinterpret_cast<Bytef*>(m_inBuffer.data());
+    m_stream.avail_in = static_cast<uInt>(read);
+    return true;
+}
+
+qint64 GZipReader::readData(char* data, qint64 maxSize)
+{
+    if (!m_initialized || m_finished) {
+        return 0;
+    }
+
+    m_stream.next_out = reinterpret_cast<Bytef*>(data);
+    m_stream.avail_out = static_cast<uInt>(qMin<qint64>(maxSize, std::numeric_limits<uInt>::max()));
+    auto requested = m_stream.avail_out;
+
+    while (m_stream.avail_out > 0) {
+        if (m_stream.avail_in == 0) {
+            if (!fillInput()) {
+                return -1;
+            }
+            if (m_stream.avail_in == 0) {
+                if (!m_sourceDrained) {
+                    // sequential source with nothing buffered yet, try again later
+                    break;
+                }
+                if (m_stream.total_in == 0) {
+                    // empty input decompresses to nothing, same as GZip::unzip
+                    m_finished = true;
+                    break;
+                }
+                setErrorString(tr("Unexpected end of compressed data"));
+                return -1;
+            }
+        }
+
+        int err = inflate(&m_stream, Z_NO_FLUSH);
+        if (err == Z_STREAM_END) {
+            // gzip allows several members back to back, keep going if there is more input
+            if (m_stream.avail_in == 0 && !fillInput()) {
+                return -1;
+            }
+            if (m_stream.avail_in == 0) {
+                m_finished = true;
+                break;
+            }
+            inflateReset(&m_stream);
+        } else if (err != Z_OK && err != Z_BUF_ERROR) {
+            setErrorString(m_stream.msg ? QString::fromUtf8(m_stream.msg) : tr("Corrupted compressed data"));
+            return -1;
+        }
+    }
+    return requested - m_stream.avail_out;
+}
+
+qint64 GZipReader::writeData(const char*, qint64)
+{
+    return -1;
+}
+
+GZipWriter::GZipWriter(QIODevice* sink, int level, QObject* parent) : QIODevice(parent), m_sink(sink), m_level(level)
+{
+    memset(&m_stream, 0, sizeof(m_stream));
+}
+
+GZipWriter::~GZipWriter()
+{
+    if (isOpen()) {
+        close();
+    }
+    if (m_initialized) {
+        deflateEnd(&m_stream);
+    }
+}
+
+bool GZipWriter::open(OpenMode mode)
+{
+    if ((mode & QIODevice::ReadWrite) != QIODevice::WriteOnly) {
+        setErrorString(tr("GZipWriter can only be opened for writing"));
+        return false;
+    }
+    if (!m_sink || !m_sink->isWritable()) {
+        setErrorString(tr("The compressed sink is not writable"));
+        return false;
+    }
+    if (m_initialized) {
+        deflateEnd(&m_stream);
+    }
+    memset(&m_stream, 0, sizeof(m_stream));
+    if (deflateInit2(&m_stream, m_level, Z_DEFLATED, (16 + MAX_WBITS), 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+        m_initialized = false;
+        setErrorString(tr("Unable to initialize the gzip compressor"));
+        return false;
+    }
+    m_initialized = true;
+    m_failed = false;
+    m_outBuffer.resize(streamChunkSize);
+    return QIODevice::open(mode | QIODevice::Unbuffered);
+}
+
+bool GZipWriter::deflateInto(int flush)
+{
+    int err = Z_OK;
+    do {
+        m_stream.next_out = reinterpret_cast<Bytef*>(m_outBuffer.data());
+        m_stream.avail_out = static_cast<uInt>(m_outBuffer.size());
+        err = deflate(&m_stream, flush);
+        if (err == Z_STREAM_ERROR) {
+            setErrorString(tr("Compression stream error"));
+            return false;
+        }
+        auto produced = m_outBuffer.size() - m_stream.avail_out;
+        if (produced > 0 && m_sink->write(m_outBuffer.constData(), produced) != produced) {
+            setErrorString(m_sink->errorString());
+            return false;
+        }
+        // the output buffer was filled completely, there may be more pending
+    } while (m_stream.avail_out == 0 || (flush == Z_FINISH && err != Z_STREAM_END));
+    return true;
+}
+
+qint64 GZipWriter::writeData(const char* data, qint64 maxSize)
+{
+    if (!m_initialized || m_failed) {
+        return -1;
+    }
+    qint64 written = 0;
+    while (written < maxSize) {
+        auto chunk = qMin<qint64>(maxSize - written, std::numeric_limits<uInt>::max());
+        m_stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data + written));
+        m_stream.avail_in = static_cast<uInt>(chunk);
+        if (!deflateInto(Z_NO_FLUSH)) {
+            m_failed = true;
+            return -1;
+        }
+        written += chunk;
+    }
+    return written;
+}
+
+qint64 GZipWriter::readData(char*, qint64)
+{
+    return -1;
+}
+
+bool GZipWriter::finish()
+{
+    if (!m_initialized) {
+        return !m_failed;
+    }
+    m_stream.next_in = nullptr;
+    m_stream.avail_in = 0;
+    if (!m_failed && !deflateInto(Z_FINISH)) {
+        m_failed = true;
+    }
+    deflateEnd(&m_stream);
+    m_initialized = false;
+    m_outBuffer.clear();
+    m_outBuffer.squeeze();
+    return !m_failed;
+}
+
+void GZipWriter::close()
+{
+    finish();
+    QIODevice::close();
+}
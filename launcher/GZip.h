@@ -1,8 +1,80 @@
 #pragma once
+#include <zlib.h>
 #include <QByteArray>
+#include <QIODevice>
 
 class GZip {
    public:
     static bool unzip(const QByteArray& compressedBytes, QByteArray& uncompressedBytes);
     static bool zip(const QByteArray& uncompressedBytes, QByteArray& compressedBytes);
 };
+
+/**
+ * Read-only sequential device inflating a gzip stream read from another device.
+ *
+ * Only a bounded chunk of compressed input is held in memory at a time, so arbitrarily large
+ * files can be decompressed without loading them whole. The source device is not owned and must
+ * be open for reading and outlive the reader.
+ */
+class GZipReader : public QIODevice {
+    Q_OBJECT
+   public:
+    explicit GZipReader(QIODevice* source, QObject* parent = nullptr);
+    virtual ~GZipReader();
+
+    bool open(OpenMode mode) override;
+    void close() override;
+    bool isSequential() const override { return true; }
+    bool atEnd() const override;
+
+   protected:
+    qint64 readData(char* data, qint64 maxSize) override;
+    qint64 writeData(const char* data, qint64 maxSize) override;
+
+   private:
+    bool fillInput();
+
+   private:
+    QIODevice* m_source;
+    QByteArray m_inBuffer;
+    z_stream m_stream;
+    bool m_initialized = false;
+    bool m_sourceDrained = false;
+    bool m_finished = false;
+};
+
+/**
+ * Write-only sequential device deflating everything written to it into a gzip stream on another device.
+ *
+ * Compressed output is flushed to the sink whenever the bounded output buffer fills up.
+ * Call finish() to terminate the gzip stream and check for errors; close() does it implicitly.
+ * The sink device is not owned and must be open for writing and outlive the writer.
+ */
+class GZipWriter : public QIODevice {
+    Q_OBJECT
+   public:
+    explicit GZipWriter(QIODevice* sink, int level = Z_DEFAULT_COMPRESSION, QObject* parent = nullptr);
+    virtual ~GZipWriter();
+
+    bool open(OpenMode mode) override;
+    void close() override;
+    bool isSequential() const override { return true; }
+
+    /** Writes the gzip trailer to the sink. Returns false if anything failed along the way. */
+    bool finish();
+
+   protected:
+    qint64 readData(char* data, qint64 maxSize) override;
+    qint64 writeData(const char* data, qint64 maxSize) override;
+
+   private:
+    bool deflateInto(int flush);
+
+   private:
+    QIODevice* m_sink;
+    int m_level;
+    QByteArray m_outBuffer;
+    z_stream m_stream;
+    bool m_initialized = false;
+    bool m_failed = false;
+};
@@ -34,12 +34,15 @@
  *      limitations under the License.
  */
 
+#include <QDataStream>
 #include <QDebug>
 #include <QDir>
 #include <QDirIterator>
+#include <QElapsedTimer>
 #include <QFile>
 #include <QFileInfo>
 #include <QFileSystemWatcher>
+#include <QFutureWatcher>
 #include <QJsonArray>
 #include <QJsonDocument>
 #include <QMimeData>
@@ -48,9 +51,11 @@
 #include <QStack>
 #include <QTextStream>
 #include <QThread>
+#include <QThreadPool>
 #include <QTimer>
 #include <QUuid>
 #include <QXmlStreamReader>
+#include <QtConcurrent>
 
 #include "BaseInstance.h"
 #include "ExponentialSeries.h"
@@ -59,6 +64,7 @@
 #include "InstanceTask.h"
 #include "NullInstance.h"
 #include "WatchLock.h"
+#include "launch/SessionLog.h"
 #include "minecraft/MinecraftInstance.h"
 #include "settings/INISettingsObject.h"
 
@@ -68,6 +74,13 @@
 
 const static int GROUP_FILE_FORMAT_VERSION = 1;
 
+const static QString SNAPSHOT_FILE = "cache/instlist.snapshot";
+const static quint32 SNAPSHOT_MAGIC = 0x494e5354;  // "INST"
+const static quint32 SNAPSHOT_FORMAT_VERSION = 1;
+
+// instances read in the background are added to the model this many at a time
+const static int LOAD_BATCH_SIZE = 16;
+
 InstanceList::InstanceList(SettingsObjectPtr settings, const QString& instDir, QObject* parent)
     : QAbstractListModel(parent), m_globalSettings(settings)
 {
@@ -84,6 +97,9 @@ InstanceList::InstanceList(SettingsObjectPtr settings, const QString& instDir, Q
     m_watcher = new QFileSystemWatcher(this);
     connect(m_watcher, &QFileSystemWatcher::directoryChanged, this, &InstanceList::instanceDirContentsChanged);
     m_watcher->addPath(m_instDir);
+
+    // reading instance.cfg dominates, especially on network drives, so many are read at once
+    m_loadPool.setMaxThreadCount(qMax(QThread::idealThreadCount(), 8));
 }
 
 InstanceList::~InstanceList() {}
@@ -409,6 +425,25 @@ void InstanceList::deleteInstance(const InstanceId& id)
     }
 
     qDebug() << "Instance" << id << "has been deleted by the launcher.";
+    QFile::remove(SessionLog::pathFor(id));
+}
+
+void InstanceList::pruneSessionLogs()
+{
+    // instances still in the list may be running and writing to theirs
+    auto keep = instanceSet;
+    for (auto& inst : m_instances) {
+        keep.insert(inst->id());
+    }
+    QDirIterator iter(SessionLog::directory(), { "*.log.gz" }, QDir::Files);
+    while (iter.hasNext()) {
+        iter.next();
+        auto id = iter.fileName().chopped(QString(".log.gz").size());
+        if (!keep.contains(id)) {
+            qDebug() << "Removing the session log of deleted instance" << id;
+            QFile::remove(iter.filePath());
+        }
+    }
 }
 
 static QMap<InstanceId, InstanceLocator> getIdMapping(const QList<InstancePtr>& list)
@@ -429,8 +464,21 @@ static QMap<InstanceId, InstanceLocator> getIdMapping(const QList<InstancePtr>&
 QList<InstanceId> InstanceList::discoverInstances()
 {
     qDebug() << "Discovering instances in" << m_instDir;
+    auto out = findInstanceIds(m_instDir);
+#if QT_VERSION >= QT_VERSION_CHECK(5, 14, 0)
+    instanceSet = QSet<QString>(out.begin(), out.end());
+#else
+    instanceSet = out.toSet();
+#endif
+    m_instancesProbed = true;
+    pruneSessionLogs();
+    return out;
+}
+
+QList<InstanceId> InstanceList::findInstanceIds(const QString& instDir)
+{
     QList<InstanceId> out;
-    QDirIterator iter(m_instDir, QDir::Dirs | QDir::NoDot | QDir::NoDotDot | QDir::Readable | QDir::Hidden, QDirIterator::FollowSymlinks);
+    QDirIterator iter(instDir, QDir::Dirs | QDir::NoDot | QDir::NoDotDot | QDir::Readable | QDir::Hidden, QDirIterator::FollowSymlinks);
     while (iter.hasNext()) {
         QString subDir = iter.next();
         QFileInfo dirInfo(subDir);
@@ -439,7 +487,7 @@ QList<InstanceId> InstanceList::discoverInstances()
         // if it is a symlink, ignore it if it goes to the instance folder
         if (dirInfo.isSymLink()) {
             QFileInfo targetInfo(dirInfo.symLinkTarget());
-            QFileInfo instDirInfo(m_instDir);
+            QFileInfo instDirInfo(instDir);
             if (targetInfo.canonicalPath() == instDirInfo.canonicalFilePath()) {
                 qDebug() << "Ignoring symlink" << subDir << "that leads into the instances folder";
                 continue;
@@ -449,20 +497,21 @@ QList<InstanceId> InstanceList::discoverInstances()
         out.append(id);
         qDebug() << "Found instance ID" << id;
     }
-#if QT_VERSION >= QT_VERSION_CHECK(5, 14, 0)
-    instanceSet = QSet<QString>(out.begin(), out.end());
-#else
-    instanceSet = out.toSet();
-#endif
-    m_instancesProbed = true;
     return out;
 }
 
-InstanceList::InstListError InstanceList::loadList()
+InstanceList::InstListError InstanceList::loadList(bool progressive)
 {
+    QElapsedTimer timer;
+    timer.start();
+
+    // whatever an earlier progressive load has not added yet is found again below
+    m_loadGeneration++;
+    m_pendingBatches = 0;
+
     auto existingIds = getIdMapping(m_instances);
 
-    QList<InstancePtr> newList;
+    QList<InstanceId> newIds;
 
     for (auto& id : discoverInstances()) {
         if (existingIds.contains(id)) {
@@ -470,12 +519,10 @@ InstanceList::InstListError InstanceList::loadList()
             existingIds.remove(id);
             qDebug() << "Should keep and soft-reload" << id;
         } else {
-            InstancePtr instPtr = loadInstance(id);
-            if (instPtr) {
-                newList.append(instPtr);
-            }
+            newIds.append(id);
         }
     }
+    auto discoveryTime = timer.restart();
 
     // TODO: looks like a general algorithm with a few specifics inserted. Do something about it.
     if (!existingIds.isEmpty()) {
@@ -513,14 +560,285 @@ InstanceList::InstListError InstanceList::loadList()
             removeNow();
         }
     }
-    if (newList.size()) {
-        add(newList);
+    qint64 parseTime = 0;
+    if (!newIds.isEmpty()) {
+        if (!m_groupsLoaded) {
+            loadGroupList();
+        }
+
+        if (progressive) {
+            loadInBackground(newIds, discoveryTime);
+            return NoError;
+        }
+
+        QList<QFuture<INIFile>> configs;
+        configs.reserve(newIds.size());
+        for (auto& id : newIds) {
+            auto configPath = FS::PathCombine(m_instDir, id, "instance.cfg");
+            configs.append(QtConcurrent::run(&m_loadPool, [configPath] {
+                INIFile ini;
+                ini.loadFile(configPath);
+                return ini;
+            }));
+        }
+
+        QList<InstancePtr> newList;
+        for (int i = 0; i < newIds.size(); i++) {
+            QElapsedTimer parseTimer;
+            parseTimer.start();
+            auto config = configs[i].result();
+            parseTime += parseTimer.elapsed();
+
+            InstancePtr instPtr = loadInstance(newIds[i], config);
+            if (instPtr) {
+                newList.append(instPtr);
+            }
+        }
+        if (newList.size()) {
+            add(newList);
+        }
     }
+    auto loadTime = timer.elapsed();
     m_dirty = false;
     updateTotalPlayTime();
+    qDebug() << "Loaded" << newIds.size() << "new instances in" << discoveryTime + loadTime << "ms (discovery:" << discoveryTime
+             << "ms, waiting for config files:" << parseTime << "ms, creating instances:" << loadTime - parseTime << "ms)";
     return NoError;
 }
 
+void InstanceList::loadInBackground(const QList<InstanceId>& ids, qint64 discoveryTime)
+{
+    // the list is incomplete until the last batch is in, so it must not be saved in the meantime
+    m_instancesProbed = false;
+    m_dirty = false;
+    m_backgroundLoad = { discoveryTime, 0, 0 };
+    m_backgroundLoadTimer.start();
+
+    const int generation = m_loadGeneration;
+    for (int i = 0; i < ids.size(); i += LOAD_BATCH_SIZE) {
+        auto batch = ids.mid(i, LOAD_BATCH_SIZE);
+        auto watcher = new QFutureWatcher<QList<INIFile>>(this);
+        connect(watcher, &QFutureWatcher<QList<INIFile>>::finished, watcher, &QObject::deleteLater);
+        connect(watcher, &QFutureWatcher<QList<INIFile>>::resultReadyAt, this, [this, watcher, batch, generation](int index) {
+            // the list was loaded again or the instance folder changed since
+            if (generation == m_loadGeneration)
+                addBatch(batch, watcher->resultAt(index));
+        });
+        watcher->setFuture(QtConcurrent::run(&m_loadPool, [instDir = m_instDir, batch] {
+            QList<INIFile> configs;
+            for (auto& id : batch) {
+                INIFile ini;
+                ini.loadFile(FS::PathCombine(instDir, id, "instance.cfg"));
+                configs.append(ini);
+            }
+            return configs;
+        }));
+        m_pendingBatches++;
+    }
+}
+
+void InstanceList::addBatch(const QList<InstanceId>& ids, const QList<INIFile>& configs)
+{
+    QElapsedTimer timer;
+    timer.start();
+    QList<InstancePtr> list;
+    for (int i = 0; i < ids.size(); i++) {
+        if (auto instPtr = loadInstance(ids[i], configs[i]))
+            list.append(instPtr);
+    }
+    if (!list.isEmpty()) {
+        add(list);
+    }
+    updateTotalPlayTime();
+    m_backgroundLoad.creationTime += timer.elapsed();
+    m_backgroundLoad.loaded += list.size();
+
+    if (--m_pendingBatches > 0)
+        return;
+    m_instancesProbed = true;
+    auto totalTime = m_backgroundLoad.discoveryTime + m_backgroundLoadTimer.elapsed();
+    qDebug() << "Loaded" << m_backgroundLoad.loaded << "new instances in" << totalTime << "ms (discovery:" << m_backgroundLoad.discoveryTime
+             << "ms, creating instances:" << m_backgroundLoad.creationTime << "ms)";
+}
+
+namespace {
+struct ConfigSignature {
+    qint64 modified = 0;
+    qint64 size = -1;
+};
+
+ConfigSignature configSignature(const QString& configPath)
+{
+    QFileInfo info(configPath);
+    if (!info.exists())
+        return {};
+    return { info.lastModified().toMSecsSinceEpoch(), info.size() };
+}
+
+struct SnapshotCheck {
+    QList<InstanceId> ids;
+    QList<InstanceId> changed;
+};
+}  // namespace
+
+bool InstanceList::loadSnapshot()
+{
+    QElapsedTimer timer;
+    timer.start();
+
+    QFile file(SNAPSHOT_FILE);
+    if (!file.open(QIODevice::ReadOnly))
+        return false;
+    // the whole thing is read at once, this is supposed to be the only file touched before the window shows up
+    QDataStream in(file.readAll());
+    file.close();
+    in.setVersion(QDataStream::Qt_5_12);
+
+    quint32 magic, version;
+    QString instDir;
+    quint32 count;
+    in >> magic >> version >> instDir >> count;
+    if (in.status() != QDataStream::Ok || magic != SNAPSHOT_MAGIC || version != SNAPSHOT_FORMAT_VERSION) {
+        qWarning() << "Ignoring unreadable instance list snapshot";
+        return false;
+    }
+    if (instDir != m_instDir) {
+        qDebug() << "Ignoring instance list snapshot of" << instDir;
+        return false;
+    }
+
+    QList<InstanceId> ids;
+    QList<INIFile> configs;
+    QMap<InstanceId, ConfigSignature> signatures;
+    for (quint32 i = 0; i < count; i++) {
+        InstanceId id;
+        ConfigSignature signature;
+        INIFile config;
+        in >> id >> signature.modified >> signature.size >> static_cast<QMap<QString, QVariant>&>(config);
+        if (in.status() != QDataStream::Ok) {
+            qWarning() << "Instance list snapshot is truncated, ignoring it";
+            return false;
+        }
+        ids.append(id);
+        configs.append(config);
+        signatures.insert(id, signature);
+    }
+    if (ids.isEmpty())
+        return false;
+
+    if (!m_groupsLoaded) {
+        loadGroupList();
+    }
+    QList<InstancePtr> list;
+    for (int i = 0; i < ids.size(); i++) {
+        if (auto instPtr = loadInstance(ids[i], configs[i]))
+            list.append(instPtr);
+    }
+    add(list);
+    m_dirty = false;
+    updateTotalPlayTime();
+    qDebug() << "Loaded" << list.size() << "instances from the snapshot in" << timer.elapsed() << "ms";
+
+    // instances that changed since the snapshot was taken are caught up once the folder has been looked at
+    auto watcher = new QFutureWatcher<SnapshotCheck>(this);
+    connect(watcher, &QFutureWatcher<SnapshotCheck>::finished, this, [this, watcher, instDir] {
+        auto result = watcher->result();
+        reconcileSnapshot(instDir, result.ids, result.changed);
+        watcher->deleteLater();
+    });
+    watcher->setFuture(QtConcurrent::run(QThreadPool::globalInstance(), [instDir, signatures] {
+        SnapshotCheck result;
+        result.ids = findInstanceIds(instDir);
+        for (auto& id : result.ids) {
+            auto configPath = FS::PathCombine(instDir, id, "instance.cfg");
+            auto known = signatures.find(id);
+            if (known == signatures.end())
+                continue;
+            auto current = configSignature(configPath);
+            if (current.modified == known->modified && current.size == known->size)
+                continue;
+            result.changed.append(id);
+        }
+        return result;
+    }));
+    return true;
+}
+
+void InstanceList::reconcileSnapshot(const QString& instDir, const QList<InstanceId>& ids, const QList<InstanceId>& changed)
+{
+    // the instance folder was switched in the meantime, that already reloaded everything
+    if (instDir != m_instDir)
+        return;
+
+    int reloaded = 0;
+    for (auto& id : changed) {
+        auto inst = getInstanceById(id);
+        if (!inst)
+            continue;
+        auto settings = std::dynamic_pointer_cast<INISettingsObject>(inst->settings());
+        if (!settings)
+            continue;
+        // whatever was changed here since is about to be written over the file anyway
+        if (settings->hasUnsavedChanges()) {
+            qDebug() << "Instance" << id << "changed since the snapshot was taken, keeping its unsaved settings";
+            continue;
+        }
+        qDebug() << "Instance" << id << "changed since the snapshot was taken, reloading its config";
+        settings->reload();
+        propertiesChanged(inst.get());
+        reloaded++;
+    }
+
+#if QT_VERSION >= QT_VERSION_CHECK(5, 14, 0)
+    auto found = QSet<QString>(ids.begin(), ids.end());
+#else
+    auto found = ids.toSet();
+#endif
+    QSet<QString> known;
+    for (auto& inst : m_instances) {
+        known.insert(inst->id());
+    }
+    if (found != known) {
+        qDebug() << "Instances were added or removed since the snapshot was taken, reloading the list";
+        loadList(true);
+    } else {
+        instanceSet = found;
+        m_instancesProbed = true;
+        pruneSessionLogs();
+    }
+    qDebug() << "Instance list snapshot reconciled," << reloaded << "instances reloaded";
+}
+
+void InstanceList::saveSnapshot()
+{
+    // a partial list would hide instances on the next start until the folder is checked
+    if (!m_instancesProbed) {
+        qDebug() << "Not saving the instance list snapshot, the instance folder was not fully read yet.";
+        return;
+    }
+
+    QList<std::pair<InstancePtr, std::shared_ptr<INISettingsObject>>> entries;
+    for (auto& inst : m_instances) {
+        if (auto settings = std::dynamic_pointer_cast<INISettingsObject>(inst->settings()))
+            entries.append({ inst, settings });
+    }
+
+    QByteArray data;
+    QDataStream out(&data, QIODevice::WriteOnly);
+    out.setVersion(QDataStream::Qt_5_12);
+    out << SNAPSHOT_MAGIC << SNAPSHOT_FORMAT_VERSION << m_instDir << quint32(entries.size());
+    for (auto& [inst, settings] : entries) {
+        auto signature = configSignature(settings->filePath());
+        out << inst->id() << signature.modified << signature.size << static_cast<const QMap<QString, QVariant>&>(settings->contents());
+    }
+    try {
+        FS::write(SNAPSHOT_FILE, data);
+        qDebug() << "Instance list snapshot saved.";
+    } catch (const FS::FileSystemException& e) {
+        qCritical() << "Failed to write instance list snapshot:" << e.cause();
+    }
+}
+
 void InstanceList::updateTotalPlayTime()
 {
     totalPlayTime = 0;
@@ -533,6 +851,7 @@ void InstanceList::saveNow()
 {
     for (auto& item : m_instances) {
         item->saveNow();
+        item->settings()->saveNow();
     }
 }
 
@@ -621,14 +940,14 @@ void InstanceList::propertiesChanged(BaseInstance* inst)
     }
 }
 
-InstancePtr InstanceList::loadInstance(const InstanceId& id)
+InstancePtr InstanceList::loadInstance(const InstanceId& id, const INIFile& config)
 {
     if (!m_groupsLoaded) {
         loadGroupList();
     }
 
     auto instanceRoot = FS::PathCombine(m_instDir, id);
-    auto instanceSettings = std::make_shared<INISettingsObject>(FS::PathCombine(instanceRoot, "instance.cfg"));
+    auto instanceSettings = std::make_shared<INISettingsObject>(FS::PathCombine(instanceRoot, "instance.cfg"), config);
     InstancePtr inst;
 
     instanceSettings->registerSetting("InstanceType", "");
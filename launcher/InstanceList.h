@@ -36,11 +36,13 @@
 #pragma once
 
 #include <QAbstractListModel>
+#include <QElapsedTimer>
 #include <QList>
 #include <QObject>
 #include <QPair>
 #include <QSet>
 #include <QStack>
+#include <QThreadPool>
 
 #include "BaseInstance.h"
 
@@ -94,9 +96,22 @@ class InstanceList : public QAbstractListModel {
 
     int count() const { return m_instances.count(); }
 
-    InstListError loadList();
+    /**
+     * Reload the list from the instance folder.
+     * When progressive, the new instances are read in the background and added in batches as they become ready,
+     * and the call returns once the removed instances are gone.
+     */
+    InstListError loadList(bool progressive = false);
     void saveNow();
 
+    /**
+     * Fill the list from the snapshot saved by saveSnapshot() on the last exit, without reading every instance.cfg.
+     * The snapshot is checked against the instance folder in the background and only changed instances are reloaded.
+     * Returns false if there is no usable snapshot, in which case loadList() has to be used.
+     */
+    bool loadSnapshot();
+    void saveSnapshot();
+
     /* O(n) */
     InstancePtr getInstanceById(QString id) const;
     /* O(n) */
@@ -177,7 +192,15 @@ class InstanceList : public QAbstractListModel {
     void loadGroupList();
     void saveGroupList();
     QList<InstanceId> discoverInstances();
-    InstancePtr loadInstance(const InstanceId& id);
+    /// remove the session logs of instances that are gone
+    void pruneSessionLogs();
+    static QList<InstanceId> findInstanceIds(const QString& instDir);
+    void reconcileSnapshot(const QString& instDir, const QList<InstanceId>& ids, const QList<InstanceId>& changed);
+    /// create the instance from its already parsed instance.cfg
+    InstancePtr loadInstance(const InstanceId& id, const INIFile& config);
+    /// read the configs of the given instances in batches and add every batch once it's read
+    void loadInBackground(const QList<InstanceId>& ids, qint64 discoveryTime);
+    void addBatch(const QList<InstanceId>& ids, const QList<INIFile>& configs);
 
     void increaseGroupCount(const QString& group);
     void decreaseGroupCount(const QString& group);
@@ -200,5 +223,16 @@ class InstanceList : public QAbstractListModel {
     bool m_groupsLoaded = false;
     bool m_instancesProbed = false;
 
+    QThreadPool m_loadPool;
+    // bumped on every load, so batches of an outdated progressive load are dropped
+    int m_loadGeneration = 0;
+    int m_pendingBatches = 0;
+    struct BackgroundLoad {
+        qint64 discoveryTime = 0;
+        qint64 creationTime = 0;
+        int loaded = 0;
+    } m_backgroundLoad;
+    QElapsedTimer m_backgroundLoadTimer;
+
     QStack<TrashHistoryItem> m_trashHistory;
 };
@@ -24,12 +24,15 @@ MessageLevel::Enum MessageLevel::getLevel(const QString& levelName)
 
 MessageLevel::Enum MessageLevel::fromLine(QString& line)
 {
-    // Level prefix
-    int endmark = line.indexOf("]!");
-    if (line.startsWith("!![") && endmark != -1) {
-        auto level = MessageLevel::getLevel(line.left(endmark).mid(3));
-        line = line.mid(endmark + 2);
-        return level;
+    // Level prefix, checked before searching for the end mark as almost no line has one
+    if (!line.startsWith(QLatin1String("!!["))) {
+        return MessageLevel::Unknown;
+    }
+    int endmark = line.indexOf(QLatin1String("]!"), 3);
+    if (endmark == -1) {
+        return MessageLevel::Unknown;
     }
-    return MessageLevel::Unknown;
+    auto level = MessageLevel::getLevel(line.mid(3, endmark - 3));
+    line.remove(0, endmark + 2);
+    return level;
 }
@@ -55,28 +55,35 @@ ResourceDownloadTask::ResourceDownloadTask(ModPlatform::IndexedPack::Ptr pack,
         }
     }
 
-    auto action = Net::ApiDownload::makeFile(m_pack_version.downloadUrl, dir.absoluteFilePath(getFilename()));
+    const auto path = dir.absoluteFilePath(getFilename());
+    const auto hash = QByteArray::fromHex(m_pack_version.hash.toLatin1());
+    // files with a strong hash go through the content store, so other instances can share them
+    Net::Download::Ptr action;
     if (!m_pack_version.hash_type.isEmpty() && !m_pack_version.hash.isEmpty()) {
         switch (Hashing::algorithmFromString(m_pack_version.hash_type)) {
             case Hashing::Algorithm::Md4:
+                action = Net::ApiDownload::makeFile(m_pack_version.downloadUrl, path);
                 action->addValidator(new Net::ChecksumValidator(QCryptographicHash::Algorithm::Md4, m_pack_version.hash));
                 break;
             case Hashing::Algorithm::Md5:
+                action = Net::ApiDownload::makeFile(m_pack_version.downloadUrl, path);
                 action->addValidator(new Net::ChecksumValidator(QCryptographicHash::Algorithm::Md5, m_pack_version.hash));
                 break;
             case Hashing::Algorithm::Sha1:
-                action->addValidator(new Net::ChecksumValidator(QCryptographicHash::Algorithm::Sha1, m_pack_version.hash));
+                action = Net::ApiDownload::makeStored(m_pack_version.downloadUrl, path, QCryptographicHash::Algorithm::Sha1, hash);
                 break;
             case Hashing::Algorithm::Sha256:
-                action->addValidator(new Net::ChecksumValidator(QCryptographicHash::Algorithm::Sha256, m_pack_version.hash));
+                action = Net::ApiDownload::makeStored(m_pack_version.downloadUrl, path, QCryptographicHash::Algorithm::Sha256, hash);
                 break;
             case Hashing::Algorithm::Sha512:
-                action->addValidator(new Net::ChecksumValidator(QCryptographicHash::Algorithm::Sha512, m_pack_version.hash));
+                action = Net::ApiDownload::makeStored(m_pack_version.downloadUrl, path, QCryptographicHash::Algorithm::Sha512, hash);
                 break;
             default:
                 break;
         }
     }
+    if (!action)
+        action = Net::ApiDownload::makeFile(m_pack_version.downloadUrl, path);
     m_filesNetJob->addNetAction(action);
     connect(m_filesNetJob.get(), &NetJob::succeeded, this, &ResourceDownloadTask::downloadSucceeded);
     connect(m_filesNetJob.get(), &NetJob::progress, this, &ResourceDownloadTask::downloadProgressChanged);
@@ -66,4 +66,10 @@ struct RuntimeContext {
 
         return x;
     }
+
+    bool operator==(const RuntimeContext& other) const
+    {
+        return javaArchitecture == other.javaArchitecture && javaRealArchitecture == other.javaRealArchitecture && system == other.system;
+    }
+    bool operator!=(const RuntimeContext& other) const { return !(*this == other); }
 };
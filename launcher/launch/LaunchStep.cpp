@@ -21,6 +21,7 @@ LaunchStep::LaunchStep(LaunchTask* parent) : Task(parent), m_parent(parent)
     connect(this, &LaunchStep::readyForLaunch, parent, &LaunchTask::onReadyForLaunch);
     connect(this, &LaunchStep::logLine, parent, &LaunchTask::onLogLine);
     connect(this, &LaunchStep::logLines, parent, &LaunchTask::onLogLines);
+    connect(this, &LaunchStep::logEvent, parent, &LaunchTask::onLogEvent);
     connect(this, &LaunchStep::finished, parent, &LaunchTask::onStepFinished);
     connect(this, &LaunchStep::progressReportingRequest, parent, &LaunchTask::onProgressReportingRequested);
 }
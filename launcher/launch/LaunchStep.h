@@ -15,6 +15,7 @@
 
 #pragma once
 
+#include "Log4jEventParser.h"
 #include "MessageLevel.h"
 #include "tasks/Task.h"
 
@@ -30,6 +31,7 @@ class LaunchStep : public Task {
    signals:
     void logLines(QStringList lines, MessageLevel::Enum level);
     void logLine(QString line, MessageLevel::Enum level);
+    void logEvent(LogEvent event);
     void readyForLaunch();
     void progressReportingRequest();
 
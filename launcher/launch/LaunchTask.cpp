@@ -43,6 +43,7 @@
 #include <QEventLoop>
 #include <QRegularExpression>
 #include <QStandardPaths>
+#include "FileSystem.h"
 #include "MessageLevel.h"
 #include "tasks/Task.h"
 
@@ -58,7 +59,7 @@ shared_qobject_ptr<LaunchTask> LaunchTask::create(MinecraftInstancePtr inst)
     return proc;
 }
 
-LaunchTask::LaunchTask(MinecraftInstancePtr instance) : m_instance(instance) {}
+LaunchTask::LaunchTask(MinecraftInstancePtr instance) : m_instance(instance), m_levelClassifier(instance->createLogLevelClassifier()) {}
 
 void LaunchTask::appendStep(shared_qobject_ptr<LaunchStep> step)
 {
@@ -210,6 +211,7 @@ shared_qobject_ptr<LogModel> LaunchTask::getLogModel()
                                           "You may have to fix your mods because the game is still logging to files and"
                                           " likely wasting harddrive space at an alarming rate!")
                                            .arg(m_logModel->getMaxLines()));
+        m_logModel->setSessionLog(new SessionLog(SessionLog::pathFor(m_instance->id()), m_logModel.get()));
     }
     return m_logModel;
 }
@@ -231,7 +233,7 @@ void LaunchTask::onLogLine(QString line, MessageLevel::Enum level)
 
     // If the level is still undetermined, guess level
     if (level == MessageLevel::StdErr || level == MessageLevel::StdOut || level == MessageLevel::Unknown) {
-        level = m_instance->guessLevel(line, level);
+        level = m_levelClassifier->classify(line, level);
     }
 
     // censor private user info
@@ -241,6 +243,24 @@ void LaunchTask::onLogLine(QString line, MessageLevel::Enum level)
     model.append(level, line);
 }
 
+void LaunchTask::onLogEvent(const LogEvent& event)
+{
+    // the level comes with the event, only guess when log4j used a level we do not know
+    LogEvent censored = event;
+    censored.message = censorPrivateInfo(event.message);
+    if (censored.level == MessageLevel::Unknown) {
+        censored.level = m_levelClassifier->classify(censored.message, MessageLevel::StdOut);
+    }
+
+    auto& model = *getLogModel();
+    model.append(censored, censored.toLine());
+    if (!event.throwable.isEmpty()) {
+        for (auto& line : censorPrivateInfo(event.throwable).split('\n')) {
+            model.append(censored, line);
+        }
+    }
+}
+
 void LaunchTask::emitSucceeded()
 {
     m_instance->setRunning(false);
@@ -41,6 +41,7 @@
 #include <QProcess>
 #include "BaseInstance.h"
 #include "LaunchStep.h"
+#include "LogLevelClassifier.h"
 #include "LogModel.h"
 #include "MessageLevel.h"
 
@@ -108,6 +109,7 @@ class LaunchTask : public Task {
    public slots:
     void onLogLines(const QStringList& lines, MessageLevel::Enum defaultLevel = MessageLevel::Launcher);
     void onLogLine(QString line, MessageLevel::Enum defaultLevel = MessageLevel::Launcher);
+    void onLogEvent(const LogEvent& event);
     void onReadyForLaunch();
     void onStepFinished();
     void onProgressReportingRequested();
@@ -118,6 +120,7 @@ class LaunchTask : public Task {
    protected: /* data */
     MinecraftInstancePtr m_instance;
     shared_qobject_ptr<LogModel> m_logModel;
+    std::unique_ptr<LogLevelClassifier> m_levelClassifier;
     QList<shared_qobject_ptr<LaunchStep>> m_steps;
     QMap<QString, QString> m_censorFilter;
     int currentStep = -1;
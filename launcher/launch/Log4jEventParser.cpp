@@ -0,0 +1,117 @@
+#include "Log4jEventParser.h"
+
+#include <QXmlStreamReader>
+
+#include "launch/LogLevelClassifier.h"
+
+namespace {
+// an event that does not end within this many lines is not one we understand
+constexpr int maxEventLines = 4096;
+
+QString localName(const QXmlStreamReader& reader)
+{
+    // namespace processing is off since the log4j prefix is never declared
+    auto name = reader.qualifiedName().toString();
+    return name.mid(name.indexOf(':') + 1);
+}
+}  // namespace
+
+QString LogEvent::toLine() const
+{
+    auto time = timestamp.isValid() ? timestamp.toString("HH:mm:ss") : QString();
+    return QString("[%1] [%2/%3]: %4").arg(time, thread, levelName, message);
+}
+
+bool Log4jEventParser::isEventStart(const QString& line)
+{
+    auto trimmed = line.trimmed();
+    return trimmed.startsWith(QLatin1String("<log4j:Event ")) || trimmed.startsWith(QLatin1String("<Event "));
+}
+
+bool Log4jEventParser::isEventEnd(const QString& line)
+{
+    return line.contains(QLatin1String("</log4j:Event>")) || line.contains(QLatin1String("</Event>"));
+}
+
+QList<Log4jEventParser::Item> Log4jEventParser::feed(const QStringList& lines)
+{
+    QList<Item> out;
+    for (auto& line : lines) {
+        if (m_buffer.isEmpty()) {
+            if (!isEventStart(line)) {
+                out.append(line);
+                continue;
+            }
+        }
+        m_buffer.append(line);
+        if (isEventEnd(line)) {
+            LogEvent event;
+            if (parseBuffer(event)) {
+                out.append(event);
+            } else {
+                for (auto& raw : m_buffer) {
+                    out.append(raw);
+                }
+            }
+            m_buffer.clear();
+        } else if (m_buffer.size() > maxEventLines) {
+            out.append(flush());
+        }
+    }
+    return out;
+}
+
+QList<Log4jEventParser::Item> Log4jEventParser::flush()
+{
+    QList<Item> out;
+    for (auto& raw : m_buffer) {
+        out.append(raw);
+    }
+    m_buffer.clear();
+    return out;
+}
+
+bool Log4jEventParser::parseBuffer(LogEvent& event) const
+{
+    QXmlStreamReader reader(m_buffer.join('\n'));
+    reader.setNamespaceProcessing(false);
+
+    bool inEvent = false;
+    while (!reader.atEnd()) {
+        reader.readNext();
+        if (reader.isStartElement()) {
+            auto name = localName(reader);
+            if (name == "Event") {
+                auto attributes = reader.attributes();
+                event.levelName = attributes.value("level").toString();
+                event.level = LogLevelClassifier::fromLog4jLevel(event.levelName, MessageLevel::Unknown);
+                event.thread = attributes.value("thread").toString();
+                event.logger = attributes.hasAttribute("logger") ? attributes.value("logger").toString()
+                                                                 : attributes.value("loggerName").toString();
+                auto millis = attributes.hasAttribute("timestamp") ? attributes.value("timestamp").toString()
+                                                                   : attributes.value("timeMillis").toString();
+                bool ok = false;
+                auto epoch = millis.toLongLong(&ok);
+                if (ok) {
+                    event.timestamp = QDateTime::fromMSecsSinceEpoch(epoch);
+                }
+                inEvent = true;
+            } else if (inEvent && name == "Message") {
+                event.message = reader.readElementText(QXmlStreamReader::IncludeChildElements);
+            } else if (inEvent && name == "Throwable") {
+                event.throwable = reader.readElementText(QXmlStreamReader::IncludeChildElements);
+            } else if (inEvent && name == "Thrown" && event.throwable.isEmpty()) {
+                auto attributes = reader.attributes();
+                event.throwable = attributes.value("name").toString();
+                auto message = attributes.value("message").toString();
+                if (!message.isEmpty()) {
+                    event.throwable += ": " + message;
+                }
+                reader.skipCurrentElement();
+            }
+        } else if (reader.isEndElement() && localName(reader) == "Event") {
+            return true;
+        }
+    }
+    return false;
+}
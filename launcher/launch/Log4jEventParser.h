@@ -0,0 +1,52 @@
+#pragma once
+
+#include <QDateTime>
+#include <QList>
+#include <QString>
+#include <QStringList>
+
+#include <variant>
+
+#include "MessageLevel.h"
+
+/// A single log event as reported by log4j, with its metadata already split out
+struct LogEvent {
+    MessageLevel::Enum level = MessageLevel::Unknown;
+    QString levelName;
+    QString logger;
+    QString thread;
+    QDateTime timestamp;
+    QString message;
+    QString throwable;
+
+    /// the event the way the default console pattern prints it: [time] [thread/LEVEL]: message
+    QString toLine() const;
+};
+
+/**
+ * Extracts log4j XML events from a stream of output lines.
+ *
+ * Understands both Mojang's LegacyXMLLayout (`<log4j:Event logger=... timestamp=... level=... thread=...>`)
+ * and the stock log4j2 XmlLayout (`<Event loggerName=... timeMillis=... level=... thread=...>`).
+ * Events are framed line by line, so plain text printed between them (System.out, native code) is
+ * passed through untouched and never has to be valid XML.
+ */
+class Log4jEventParser {
+   public:
+    using Item = std::variant<QString, LogEvent>;
+
+    /// consume more output lines, returns everything that is complete so far in order
+    QList<Item> feed(const QStringList& lines);
+    /// the stream ended, returns whatever is still buffered
+    QList<Item> flush();
+
+    bool isBuffering() const { return !m_buffer.isEmpty(); }
+
+   private:
+    static bool isEventStart(const QString& line);
+    static bool isEventEnd(const QString& line);
+    bool parseBuffer(LogEvent& event) const;
+
+   private:
+    QStringList m_buffer;
+};
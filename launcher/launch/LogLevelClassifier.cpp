@@ -0,0 +1,146 @@
+#include "LogLevelClassifier.h"
+
+#include <QDebug>
+
+LogLevelClassifier::Pattern LogLevelClassifier::compile(const QString& pattern, const QString& requiredLiteral)
+{
+    Pattern compiled{ requiredLiteral, QRegularExpression(pattern) };
+    if (!compiled.expression.isValid()) {
+        qWarning() << "Invalid log level pattern" << pattern << ":" << compiled.expression.errorString();
+    }
+    // JIT compile right away instead of after a number of uses
+    compiled.expression.optimize();
+    return compiled;
+}
+
+bool LogLevelClassifier::Pattern::matches(const QString& line) const
+{
+    if (!requiredLiteral.isEmpty() && !line.contains(requiredLiteral)) {
+        return false;
+    }
+    return expression.match(line).hasMatch();
+}
+
+void LogLevelClassifier::addHeaderPattern(const QString& pattern, const QString& requiredLiteral)
+{
+    m_headerPatterns.append(compile(pattern, requiredLiteral));
+}
+
+void LogLevelClassifier::addTag(const QString& tag, MessageLevel::Enum level)
+{
+    m_tags.append({ tag, level });
+}
+
+void LogLevelClassifier::addFatalLiteral(const QString& literal)
+{
+    m_fatalLiterals.append(literal);
+}
+
+void LogLevelClassifier::addErrorLiteral(const QString& literal)
+{
+    m_errorLiterals.append(literal);
+}
+
+void LogLevelClassifier::addErrorPattern(const QString& pattern, const QString& requiredLiteral)
+{
+    m_errorPatterns.append(compile(pattern, requiredLiteral));
+}
+
+void LogLevelClassifier::addLog4jRules()
+{
+    addHeaderPattern("\\[(?<timestamp>[0-9:]+)\\] \\[[^/]+/(?<level>[^\\]]+)\\]", "] [");
+}
+
+void LogLevelClassifier::addModLauncherRules()
+{
+    // [22Jan2024 12:34:56.789] [main/INFO] [cpw.mods.modlauncher.Launcher/MODLAUNCHER]:
+    addHeaderPattern("\\[(?<timestamp>[0-9]{2}[A-Za-z]{3}[0-9]{4} [0-9:.]+)\\] \\[[^/]+/(?<level>[A-Z]+)\\]", "] [");
+}
+
+void LogLevelClassifier::addLegacyForgeRules()
+{
+    for (auto tag : { "[INFO]", "[CONFIG]", "[FINE]", "[FINER]", "[FINEST]" }) {
+        addTag(tag, MessageLevel::Message);
+    }
+    addTag("[SEVERE]", MessageLevel::Error);
+    addTag("[STDERR]", MessageLevel::Error);
+    addTag("[WARNING]", MessageLevel::Warning);
+    addTag("[DEBUG]", MessageLevel::Debug);
+}
+
+void LogLevelClassifier::addJavaExceptionRules()
+{
+    // NOTE: this diverges from the real regexp. no unicode, the first section is + instead of *
+    static const QString javaSymbol = "([a-zA-Z_$][a-zA-Z\\d_$]*\\.)+[a-zA-Z_$][a-zA-Z\\d_$]*";
+    addErrorLiteral("Exception in thread");
+    addErrorPattern("\\s+at " + javaSymbol, "at ");
+    addErrorPattern("Caused by: " + javaSymbol, "Caused by: ");
+    addErrorPattern("([a-zA-Z_$][a-zA-Z\\d_$]*\\.)+[a-zA-Z_$]?[a-zA-Z\\d_$]*Exception", "Exception");
+    addErrorPattern("([a-zA-Z_$][a-zA-Z\\d_$]*\\.)+[a-zA-Z_$]?[a-zA-Z\\d_$]*Error", "Error");
+    addErrorPattern("([a-zA-Z_$][a-zA-Z\\d_$]*\\.)+[a-zA-Z_$]?[a-zA-Z\\d_$]*Throwable", "Throwable");
+    addErrorPattern("... \\d+ more$", " more");
+}
+
+void LogLevelClassifier::addMinecraftRules()
+{
+    addLog4jRules();
+    addModLauncherRules();
+    addLegacyForgeRules();
+    addFatalLiteral("overwriting existing");
+    addJavaExceptionRules();
+}
+
+MessageLevel::Enum LogLevelClassifier::fromLog4jLevel(const QString& levelName, MessageLevel::Enum fallback)
+{
+    if (levelName == QLatin1String("INFO"))
+        return MessageLevel::Message;
+    if (levelName == QLatin1String("WARN"))
+        return MessageLevel::Warning;
+    if (levelName == QLatin1String("ERROR"))
+        return MessageLevel::Error;
+    if (levelName == QLatin1String("FATAL"))
+        return MessageLevel::Fatal;
+    if (levelName == QLatin1String("TRACE") || levelName == QLatin1String("DEBUG"))
+        return MessageLevel::Debug;
+    return fallback;
+}
+
+MessageLevel::Enum LogLevelClassifier::classify(const QString& line, MessageLevel::Enum level) const
+{
+    bool headerMatched = false;
+    for (auto& header : m_headerPatterns) {
+        if (!header.requiredLiteral.isEmpty() && !line.contains(header.requiredLiteral)) {
+            continue;
+        }
+        auto match = header.expression.match(line);
+        if (match.hasMatch()) {
+            level = fromLog4jLevel(match.captured(QStringLiteral("level")), level);
+            headerMatched = true;
+            break;
+        }
+    }
+    if (!headerMatched) {
+        for (auto& [tag, tagLevel] : m_tags) {
+            if (line.contains(tag)) {
+                level = tagLevel;
+            }
+        }
+    }
+
+    for (auto& literal : m_fatalLiterals) {
+        if (line.contains(literal)) {
+            return MessageLevel::Fatal;
+        }
+    }
+    for (auto& literal : m_errorLiterals) {
+        if (line.contains(literal)) {
+            return MessageLevel::Error;
+        }
+    }
+    for (auto& pattern : m_errorPatterns) {
+        if (pattern.matches(line)) {
+            return MessageLevel::Error;
+        }
+    }
+    return level;
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <QList>
+#include <QRegularExpression>
+#include <QString>
+
+#include <memory>
+
+#include "MessageLevel.h"
+
+/**
+ * Guesses the level of log lines that did not come with one.
+ *
+ * All patterns are compiled once when they are registered, and every regular expression is paired with
+ * a literal that must be present in the line for the (much slower) expression to be tried at all.
+ * Instances build one of these per launch, see BaseInstance::createLogLevelClassifier().
+ */
+class LogLevelClassifier {
+   public:
+    /**
+     * Adds a log header pattern. It needs a named capture group `level` containing a log4j level name.
+     * Header patterns are tried in registration order, the first matching one decides the level.
+     */
+    void addHeaderPattern(const QString& pattern, const QString& requiredLiteral);
+
+    /** Used when no header pattern matched. All matching tags apply in order, the last one wins. */
+    void addTag(const QString& tag, MessageLevel::Enum level);
+
+    /** Lines matching any of these are always fatal. */
+    void addFatalLiteral(const QString& literal);
+
+    /** Lines matching any of these are always errors, e.g. parts of a stack trace. */
+    void addErrorLiteral(const QString& literal);
+    void addErrorPattern(const QString& pattern, const QString& requiredLiteral);
+
+    /** log4j `[time] [thread/LEVEL]` headers as written by vanilla, Fabric and Quilt. */
+    void addLog4jRules();
+    /** (Neo)Forge's modlauncher headers, which put a full date in front of the time. */
+    void addModLauncherRules();
+    /** Old style Forge `[LEVEL]` tags. */
+    void addLegacyForgeRules();
+    /** Java exception and stack trace lines. */
+    void addJavaExceptionRules();
+    /** Everything the game and its mod loaders write, as used by MinecraftInstance. */
+    void addMinecraftRules();
+
+    MessageLevel::Enum classify(const QString& line, MessageLevel::Enum level) const;
+
+    static MessageLevel::Enum fromLog4jLevel(const QString& levelName, MessageLevel::Enum fallback);
+
+   private:
+    struct Pattern {
+        QString requiredLiteral;
+        QRegularExpression expression;
+        bool matches(const QString& line) const;
+    };
+    static Pattern compile(const QString& pattern, const QString& requiredLiteral);
+
+    QList<Pattern> m_headerPatterns;
+    QList<std::pair<QString, MessageLevel::Enum>> m_tags;
+    QStringList m_fatalLiterals;
+    QStringList m_errorLiterals;
+    QList<Pattern> m_errorPatterns;
+};
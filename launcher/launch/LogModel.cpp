@@ -3,6 +3,7 @@
 LogModel::LogModel(QObject* parent) : QAbstractListModel(parent)
 {
     m_content.resize(m_maxLines);
+    connect(&m_pageReader, &QFutureWatcher<QList<SessionLog::Line>>::finished, this, &LogModel::pageRead);
 }
 
 int LogModel::rowCount(const QModelIndex& parent) const
@@ -10,21 +11,36 @@ int LogModel::rowCount(const QModelIndex& parent) const
     if (parent.isValid())
         return 0;
 
-    return m_numLines;
+    return m_paged ? m_page.size() : m_numLines;
+}
+
+const LogModel::entry& LogModel::at(int row) const
+{
+    if (m_paged)
+        return m_page[row];
+    return m_content[(row + m_firstLine) % m_maxLines];
 }
 
 QVariant LogModel::data(const QModelIndex& index, int role) const
 {
-    if (index.row() < 0 || index.row() >= m_numLines)
+    if (index.row() < 0 || index.row() >= rowCount())
         return QVariant();
 
-    auto row = index.row();
-    auto realRow = (row + m_firstLine) % m_maxLines;
+    auto& entry = at(index.row());
     if (role == Qt::DisplayRole || role == Qt::EditRole) {
-        return m_content[realRow].line;
+        return entry.line;
     }
     if (role == LevelRole) {
-        return m_content[realRow].level;
+        return entry.level;
+    }
+    if (role == LoggerRole) {
+        return entry.logger;
+    }
+    if (role == ThreadRole) {
+        return entry.thread;
+    }
+    if (role == TimestampRole) {
+        return entry.timestamp;
     }
 
     return QVariant();
@@ -32,9 +48,26 @@ QVariant LogModel::data(const QModelIndex& index, int role) const
 
 void LogModel::append(MessageLevel::Enum level, QString line)
 {
+    appendEntry(level, line, nullptr);
+}
+
+void LogModel::append(const LogEvent& event, QString line)
+{
+    appendEntry(event.level, line, &event);
+}
+
+void LogModel::appendEntry(MessageLevel::Enum level, QString line, const LogEvent* event)
+{
+    qint64 sessionLine = -1;
+    if (m_sessionLog) {
+        sessionLine = m_sessionLog->lineCount();
+        m_sessionLog->append(level, line);
+    }
     if (m_suspended) {
         return;
     }
+    // while older lines are shown, the buffer keeps following the session without the view noticing
+    const bool notify = !m_paged;
     int lineNum = (m_firstLine + m_numLines) % m_maxLines;
     // overflow
     if (m_numLines == m_maxLines) {
@@ -42,19 +75,28 @@ void LogModel::append(MessageLevel::Enum level, QString line)
             // nothing more to do, the buffer is full
             return;
         }
-        beginRemoveRows(QModelIndex(), 0, 0);
+        if (notify)
+            beginRemoveRows(QModelIndex(), 0, 0);
         m_firstLine = (m_firstLine + 1) % m_maxLines;
         m_numLines--;
-        endRemoveRows();
+        if (notify)
+            endRemoveRows();
     } else if (m_numLines == m_maxLines - 1 && m_stopOnOverflow) {
         level = MessageLevel::Fatal;
         line = m_overflowMessage;
     }
-    beginInsertRows(QModelIndex(), m_numLines, m_numLines);
+    if (notify)
+        beginInsertRows(QModelIndex(), m_numLines, m_numLines);
     m_numLines++;
-    m_content[lineNum].level = level;
-    m_content[lineNum].line = line;
-    endInsertRows();
+    auto& added = m_content[lineNum];
+    added.level = level;
+    added.line = line;
+    added.logger = event ? event->logger : QString();
+    added.thread = event ? event->thread : QString();
+    added.timestamp = event ? event->timestamp : QDateTime();
+    added.sessionLine = sessionLine;
+    if (notify)
+        endInsertRows();
 }
 
 void LogModel::suspend(bool suspend)
@@ -69,19 +111,114 @@ bool LogModel::suspended()
 
 void LogModel::clear()
 {
+    const bool wasPaged = m_paged;
     beginResetModel();
     m_firstLine = 0;
     m_numLines = 0;
+    m_paged = false;
+    m_page.clear();
+    endResetModel();
+    if (wasPaged) {
+        emit windowChanged();
+    }
+}
+
+void LogModel::setSessionLog(SessionLog* sessionLog)
+{
+    m_sessionLog = sessionLog;
+}
+
+qint64 LogModel::bufferStart() const
+{
+    if (m_numLines > 0 && m_content[m_firstLine].sessionLine >= 0) {
+        return m_content[m_firstLine].sessionLine;
+    }
+    return m_sessionLog ? m_sessionLog->lineCount() : 0;
+}
+
+bool LogModel::canShowEarlier() const
+{
+    return m_sessionLog && (m_paged ? m_pageFirst : bufferStart()) > 0;
+}
+
+void LogModel::showEarlier()
+{
+    if (!canShowEarlier()) {
+        return;
+    }
+    auto end = m_paged ? m_pageFirst : bufferStart();
+    showPage(qMax<qint64>(0, end - m_maxLines), end);
+}
+
+void LogModel::showLater()
+{
+    if (!m_paged) {
+        return;
+    }
+    // the buffer takes over where the session log was read up to
+    auto first = m_pageFirst + m_page.size();
+    auto end = bufferStart();
+    if (first >= end) {
+        showLatest();
+        return;
+    }
+    showPage(first, qMin<qint64>(end, first + m_maxLines));
+}
+
+void LogModel::showLatest()
+{
+    if (!m_paged) {
+        return;
+    }
+    beginResetModel();
+    m_paged = false;
+    m_page.clear();
+    m_page.squeeze();
+    endResetModel();
+    emit windowChanged();
+}
+
+void LogModel::showPage(qint64 first, qint64 end)
+{
+    // one page at a time, the window moves once it has been read
+    if (!m_sessionLog || m_pageReader.isRunning()) {
+        return;
+    }
+    m_requestedFirst = first;
+    m_pageReader.setFuture(m_sessionLog->read(first, end - first));
+}
+
+void LogModel::pageRead()
+{
+    auto lines = m_pageReader.result();
+    if (lines.isEmpty()) {
+        // past the size limit of the session log, nothing to show but the buffer
+        showLatest();
+        return;
+    }
+    beginResetModel();
+    m_paged = true;
+    m_pageFirst = m_requestedFirst;
+    m_page.clear();
+    m_page.reserve(lines.size());
+    for (auto& line : lines) {
+        entry added;
+        added.level = line.level;
+        added.line = line.text;
+        added.sessionLine = m_pageFirst + m_page.size();
+        m_page.append(added);
+    }
     endResetModel();
+    emit windowChanged();
 }
 
 QString LogModel::toPlainText()
 {
+    auto count = rowCount();
     QString out;
-    out.reserve(m_numLines * 80);
-    for (int i = 0; i < m_numLines; i++) {
-        QString& line = m_content[(m_firstLine + i) % m_maxLines].line;
-        out.append(line + '\n');
+    out.reserve(count * 80);
+    for (int i = 0; i < count; i++) {
+        out.append(at(i).line + '\n');
     }
     out.squeeze();
     return out;
@@ -111,13 +248,15 @@ void LogModel::setMaxLines(int maxLines)
     } else {
         // if it doesn't fit, part of the data needs to be thrown away (the oldest log messages)
         int lead = m_numLines - maxLines;
-        beginRemoveRows(QModelIndex(), 0, lead - 1);
+        if (!m_paged)
+            beginRemoveRows(QModelIndex(), 0, lead - 1);
         for (int i = 0; i < maxLines; i++) {
             newContent[i] = m_content[(m_firstLine + lead + i) % m_maxLines];
         }
         m_numLines = m_maxLines;
         m_content.swap(newContent);
-        endRemoveRows();
+        if (!m_paged)
+            endRemoveRows();
     }
     m_firstLine = 0;
     m_maxLines = maxLines;
@@ -1,8 +1,12 @@
 #pragma once
 
 #include <QAbstractListModel>
+#include <QDateTime>
+#include <QFutureWatcher>
 #include <QString>
+#include "Log4jEventParser.h"
 #include "MessageLevel.h"
+#include "SessionLog.h"
 
 class LogModel : public QAbstractListModel {
     Q_OBJECT
@@ -13,13 +17,31 @@ class LogModel : public QAbstractListModel {
     QVariant data(const QModelIndex& index, int role) const;
 
     void append(MessageLevel::Enum, QString line);
+    /// append a line belonging to a structured event, its logger, thread and time become available as roles
+    void append(const LogEvent& event, QString line);
     void clear();
 
     void suspend(bool suspend);
     bool suspended();
 
+    /// the lines in the window, i.e. what a view of this model shows
     QString toPlainText();
 
+    /// capture every appended line to disk, even the ones dropped from the buffer or while suspended
+    void setSessionLog(SessionLog* sessionLog);
+    SessionLog* sessionLog() const { return m_sessionLog; }
+
+    /**
+     * The model is a window over the session log. It normally follows the newest lines, kept in the buffer,
+     * and can be moved back to show older lines, which are read back from the session log one buffer length at a time.
+     * Lines keep being added to the buffer meanwhile, they show up once the window follows them again.
+     */
+    bool canShowEarlier() const;
+    bool isShowingLatest() const { return !m_paged; }
+    void showEarlier();
+    void showLater();
+    void showLatest();
+
     int getMaxLines();
     void setMaxLines(int maxLines);
     void setStopOnOverflow(bool stop);
@@ -28,12 +50,22 @@ class LogModel : public QAbstractListModel {
     void setLineWrap(bool state);
     bool wrapLines() const;
 
-    enum Roles { LevelRole = Qt::UserRole };
+    enum Roles { LevelRole = Qt::UserRole, LoggerRole, ThreadRole, TimestampRole };
+
+   signals:
+    /// the window moved to other lines of the session
+    void windowChanged();
 
    private /* types */:
     struct entry {
         MessageLevel::Enum level;
         QString line;
+        // only set for lines coming from structured log events
+        QString logger;
+        QString thread;
+        QDateTime timestamp;
+        // number of the line in the session log, -1 without one
+        qint64 sessionLine = -1;
     };
 
    private: /* data */
@@ -47,6 +79,22 @@ class LogModel : public QAbstractListModel {
     QString m_overflowMessage = "OVERFLOW";
     bool m_suspended = false;
     bool m_lineWrap = true;
+    SessionLog* m_sessionLog = nullptr;
+
+    // lines read back from the session log, shown instead of the buffer when paged
+    bool m_paged = false;
+    QVector<entry> m_page;
+    qint64 m_pageFirst = 0;
+    qint64 m_requestedFirst = 0;
+    QFutureWatcher<QList<SessionLog::Line>> m_pageReader;
+
+   private:
+    void appendEntry(MessageLevel::Enum level, QString line, const LogEvent* event);
+    const entry& at(int row) const;
+    /// session line number of the first line in the buffer
+    qint64 bufferStart() const;
+    void showPage(qint64 first, qint64 end);
+    void pageRead();
 
    private:
     Q_DISABLE_COPY(LogModel)
@@ -0,0 +1,238 @@
+#include "LogTailer.h"
+
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+
+#include <algorithm>
+#include <memory>
+
+#include "GZip.h"
+
+namespace {
+constexpr int headSize = 256;
+constexpr int tailSize = 256;
+constexpr qint64 readChunkSize = 1024 * 1024;
+// only the most recently modified files next to the tailed one can be its rotated copy
+constexpr int maxRotatedCandidates = 3;
+// lots of writes in a short time are picked up in one go
+constexpr int pollDelayMs = 100;
+}  // namespace
+
+LogTailer::LogTailer(QObject* parent) : QObject(parent), m_watcher(new QFileSystemWatcher(this))
+{
+    m_pollTimer.setSingleShot(true);
+    m_pollTimer.setInterval(pollDelayMs);
+    connect(&m_pollTimer, &QTimer::timeout, this, &LogTailer::poll);
+    connect(m_watcher, &QFileSystemWatcher::fileChanged, this, &LogTailer::fileChanged);
+    connect(m_watcher, &QFileSystemWatcher::directoryChanged, this, &LogTailer::directoryChanged);
+}
+
+void LogTailer::setFileName(const QString& path)
+{
+    stop();
+    m_path = path;
+}
+
+void LogTailer::start()
+{
+    if (m_running || m_path.isEmpty()) {
+        return;
+    }
+    m_running = true;
+    m_offset = 0;
+    m_head.clear();
+    m_tail.clear();
+    m_pending.clear();
+    m_skipFirstLine = false;
+
+    QFileInfo info(m_path);
+    if (info.exists() && info.size() > m_initialBacklog) {
+        m_offset = info.size() - m_initialBacklog;
+        m_skipFirstLine = true;
+    }
+    watch();
+    poll();
+}
+
+void LogTailer::stop()
+{
+    if (!m_running) {
+        return;
+    }
+    m_running = false;
+    m_pollTimer.stop();
+    if (!m_watcher->files().isEmpty()) {
+        m_watcher->removePaths(m_watcher->files());
+    }
+    if (!m_watcher->directories().isEmpty()) {
+        m_watcher->removePaths(m_watcher->directories());
+    }
+}
+
+void LogTailer::watch()
+{
+    // the directory is watched too, so we notice the file being recreated after a rotation
+    auto dir = QFileInfo(m_path).absolutePath();
+    if (!m_watcher->directories().contains(dir)) {
+        m_watcher->addPath(dir);
+    }
+    if (QFile::exists(m_path) && !m_watcher->files().contains(m_path)) {
+        m_watcher->addPath(m_path);
+    }
+}
+
+void LogTailer::fileChanged(const QString&)
+{
+    if (!m_pollTimer.isActive()) {
+        m_pollTimer.start();
+    }
+}
+
+void LogTailer::directoryChanged(const QString&)
+{
+    watch();
+    if (!m_pollTimer.isActive()) {
+        m_pollTimer.start();
+    }
+}
+
+void LogTailer::poll()
+{
+    if (!m_running) {
+        return;
+    }
+    QFile file(m_path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        // rotated away, wait for it to come back
+        return;
+    }
+
+    auto size = file.size();
+    bool replaced = size < m_offset;
+    if (!replaced && !m_head.isEmpty()) {
+        replaced = !file.read(m_head.size()).startsWith(m_head);
+    }
+    if (!replaced && !m_tail.isEmpty()) {
+        replaced = !file.seek(m_offset - m_tail.size()) || file.read(m_tail.size()) != m_tail;
+    }
+    if (replaced) {
+        auto drained = drainRotated();
+        m_offset = 0;
+        m_head.clear();
+        m_tail.clear();
+        m_pending.clear();
+        m_skipFirstLine = false;
+        if (!drained) {
+            emit reset();
+        }
+    }
+    if (m_head.size() < headSize) {
+        file.seek(0);
+        m_head = file.read(headSize);
+    }
+
+    if (size == m_offset || !file.seek(m_offset)) {
+        return;
+    }
+    readRest(&file);
+}
+
+void LogTailer::readRest(QIODevice* device)
+{
+    while (!device->atEnd()) {
+        auto chunk = device->read(readChunkSize);
+        if (chunk.isEmpty()) {
+            break;
+        }
+        m_offset += chunk.size();
+        m_tail = (m_tail + chunk).right(tailSize);
+        emitLines(chunk);
+    }
+}
+
+bool LogTailer::drainRotated()
+{
+    if (m_head.isEmpty()) {
+        return false;
+    }
+    QFileInfo current(m_path);
+    auto siblings = current.absoluteDir().entryInfoList(QDir::Files, QDir::Time);
+    int candidates = 0;
+    for (auto& sibling : siblings) {
+        if (sibling.absoluteFilePath() == current.absoluteFilePath()) {
+            continue;
+        }
+        if (candidates++ == maxRotatedCandidates) {
+            break;
+        }
+        QFile file(sibling.absoluteFilePath());
+        if (!file.open(QIODevice::ReadOnly)) {
+            continue;
+        }
+        QIODevice* device = &file;
+        std::unique_ptr<GZipReader> reader;
+        if (sibling.suffix() == "gz") {
+            reader = std::make_unique<GZipReader>(&file);
+            if (!reader->open(QIODevice::ReadOnly)) {
+                continue;
+            }
+            device = reader.get();
+        }
+
+        // it has to start like the old file did, and have the same bytes right before where we stopped reading
+        auto head = device->read(m_head.size());
+        if (head != m_head) {
+            continue;
+        }
+        qint64 position = head.size();
+        auto window = head.left(m_offset).right(tailSize);
+        while (position < m_offset) {
+            auto chunk = device->read(std::min(readChunkSize, m_offset - position));
+            if (chunk.isEmpty()) {
+                break;
+            }
+            position += chunk.size();
+            window = (window + chunk).right(tailSize);
+        }
+        if (position < m_offset || !window.endsWith(m_tail)) {
+            continue;
+        }
+
+        if (position > m_offset) {
+            emitLines(head.mid(m_offset));
+        }
+        readRest(device);
+        // the old file is done, so is its last line
+        if (!m_pending.isEmpty()) {
+            emitLines(QByteArray("\n"));
+        }
+        return true;
+    }
+    return false;
+}
+
+void LogTailer::emitLines(const QByteArray& chunk)
+{
+    QStringList lines;
+    qsizetype start = 0;
+    qsizetype end;
+    while ((end = chunk.indexOf('\n', start)) != -1) {
+        QByteArray line = m_pending + chunk.mid(start, end - start);
+        m_pending.clear();
+        start = end + 1;
+        if (m_skipFirstLine) {
+            // we started in the middle of the file, the first line is most likely cut off
+            m_skipFirstLine = false;
+            continue;
+        }
+        if (line.endsWith('\r')) {
+            line.chop(1);
+        }
+        lines.append(QString::fromUtf8(line));
+    }
+    m_pending += chunk.mid(start);
+    if (!lines.isEmpty()) {
+        emit linesAppended(lines);
+    }
+}
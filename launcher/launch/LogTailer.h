@@ -0,0 +1,62 @@
+#pragma once
+
+#include <QFileSystemWatcher>
+#include <QObject>
+#include <QStringList>
+#include <QTimer>
+
+/**
+ * Follows a text file that keeps being appended to, like `tail -F`.
+ *
+ * Only bytes written since the last read are consumed. When the file is rotated away and recreated, like log4j does,
+ * the lines written to the old file since the last read are picked up from the rotated copy next to it (plain or gzipped)
+ * and reading goes on with the new file. If no such copy is found, e.g. because the file was truncated in place,
+ * reset() is emitted and reading starts over.
+ */
+class LogTailer : public QObject {
+    Q_OBJECT
+   public:
+    explicit LogTailer(QObject* parent = nullptr);
+
+    void setFileName(const QString& path);
+    QString fileName() const { return m_path; }
+
+    /** How much of an existing file is read when tailing starts, in bytes. */
+    void setInitialBacklog(qint64 bytes) { m_initialBacklog = bytes; }
+
+    bool isRunning() const { return m_running; }
+
+   public slots:
+    void start();
+    void stop();
+    void poll();
+
+   signals:
+    void linesAppended(const QStringList& lines);
+    void reset();
+
+   private:
+    void watch();
+    void readRest(QIODevice* device);
+    bool drainRotated();
+    void emitLines(const QByteArray& chunk);
+
+   private slots:
+    void fileChanged(const QString& path);
+    void directoryChanged(const QString& path);
+
+   private:
+    QFileSystemWatcher* m_watcher;
+    QTimer m_pollTimer;
+    QString m_path;
+    bool m_running = false;
+    qint64 m_initialBacklog = 1024 * 1024;
+
+    qint64 m_offset = 0;
+    // leading bytes of the file and the bytes right before m_offset, to notice it was replaced and to find its rotated copy
+    QByteArray m_head;
+    QByteArray m_tail;
+    // trailing bytes without a newline yet
+    QByteArray m_pending;
+    bool m_skipFirstLine = false;
+};
@@ -0,0 +1,232 @@
+#include "SessionLog.h"
+
+#include <QDebug>
+#include <QFileInfo>
+#include <QSaveFile>
+#include <QtConcurrent>
+
+#include "FileSystem.h"
+#include "GZip.h"
+
+namespace {
+constexpr int submitDelayMs = 250;
+constexpr int maxPendingLines = 2000;
+// start a new gzip member this often, so the file stays readable while it is written
+constexpr qint64 memberSize = 1024 * 1024;
+// a game spamming the log must not fill the disk
+constexpr qint64 maxSessionSize = 1024ll * 1024ll * 1024ll;
+constexpr qint64 readChunkSize = 1024 * 1024;
+
+// a record is the level as a single digit followed by the line
+QByteArray encode(const SessionLog::Line& line)
+{
+    return char('0' + line.level) + line.text.toUtf8() + '\n';
+}
+
+SessionLog::Line decode(const QByteArray& record)
+{
+    if (!record.isEmpty() && record[0] >= '0' && record[0] <= '0' + MessageLevel::Fatal)
+        return { static_cast<MessageLevel::Enum>(record[0] - '0'), QString::fromUtf8(record.mid(1)) };
+    return { MessageLevel::Unknown, QString::fromUtf8(record) };
+}
+}  // namespace
+
+SessionLog::SessionLog(const QString& path, QObject* parent) : QObject(parent), m_path(path), m_file(path)
+{
+    m_writerPool.setMaxThreadCount(1);
+    m_submitTimer.setSingleShot(true);
+    m_submitTimer.setInterval(submitDelayMs);
+    connect(&m_submitTimer, &QTimer::timeout, this, &SessionLog::submit);
+
+    if (!FS::ensureFilePathExists(m_path) || !m_file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        qWarning() << "Unable to open session log" << m_path << ":" << m_file.errorString();
+        return;
+    }
+    m_writer = std::make_unique<GZipWriter>(&m_file);
+    if (!m_writer->open(QIODevice::WriteOnly)) {
+        qWarning() << "Unable to compress session log" << m_path << ":" << m_writer->errorString();
+        m_writer.reset();
+        return;
+    }
+    m_members.append({ 0, 0 });
+}
+
+QString SessionLog::directory()
+{
+    return FS::PathCombine("logs", "instances");
+}
+
+QString SessionLog::pathFor(const QString& instanceId)
+{
+    return FS::PathCombine(directory(), instanceId + ".log.gz");
+}
+
+SessionLog::~SessionLog()
+{
+    submit();
+    m_writerPool.waitForDone();
+    QMutexLocker locker(&m_writerLock);
+    if (m_writer) {
+        m_writer->close();
+        m_writer.reset();
+    }
+    m_file.close();
+}
+
+void SessionLog::append(MessageLevel::Enum level, const QString& line)
+{
+    m_pending.append({ level, line });
+    m_lineCount++;
+    if (m_pending.size() >= maxPendingLines) {
+        submit();
+    } else if (!m_submitTimer.isActive()) {
+        m_submitTimer.start();
+    }
+}
+
+void SessionLog::submit()
+{
+    m_submitTimer.stop();
+    if (m_pending.isEmpty()) {
+        return;
+    }
+    QList<Line> batch;
+    batch.swap(m_pending);
+    QtConcurrent::run(&m_writerPool, [this, batch] { writeBatch(batch); });
+}
+
+void SessionLog::writeBatch(const QList<Line>& lines)
+{
+    QMutexLocker locker(&m_writerLock);
+    if (!m_writer || m_capped) {
+        return;
+    }
+    QByteArray data;
+    for (auto& line : lines) {
+        data.append(encode(line));
+    }
+    qint64 written = lines.size();
+    if (m_totalBytes + data.size() > maxSessionSize) {
+        m_capped = true;
+        data = encode({ MessageLevel::Fatal, "Session log exceeded its size limit, further output was not saved." });
+        written = 1;
+    }
+    if (m_writer->write(data) != data.size()) {
+        qWarning() << "Unable to write session log" << m_path << ":" << m_writer->errorString();
+        m_writer.reset();
+        return;
+    }
+    m_linesWritten += written;
+    m_memberBytes += data.size();
+    m_totalBytes += data.size();
+    if (m_memberBytes >= memberSize) {
+        finishMember();
+    }
+}
+
+bool SessionLog::finishMember()
+{
+    m_memberBytes = 0;
+    m_writer->close();
+    if (!m_writer->finish() || !m_file.flush() || !m_writer->open(QIODevice::WriteOnly)) {
+        qWarning() << "Unable to write session log" << m_path << ":" << m_writer->errorString();
+        m_writer.reset();
+        return false;
+    }
+    m_members.append({ m_file.pos(), m_linesWritten });
+    return true;
+}
+
+SessionLog::Member SessionLog::seekableMember(qint64 first)
+{
+    QMutexLocker locker(&m_writerLock);
+    // the member being written can't be read back until it is finished
+    if (m_writer && m_memberBytes > 0) {
+        finishMember();
+    }
+    Member found{ 0, 0 };
+    for (auto& member : m_members) {
+        if (member.firstLine > first)
+            break;
+        found = member;
+    }
+    return found;
+}
+
+bool SessionLog::readRecords(qint64 offset, const std::function<bool(const QByteArray&)>& handle)
+{
+    QFile file(m_path);
+    if (!file.open(QIODevice::ReadOnly) || !file.seek(offset)) {
+        qWarning() << "Unable to read session log" << m_path << ":" << file.errorString();
+        return false;
+    }
+    GZipReader reader(&file);
+    if (!reader.open(QIODevice::ReadOnly)) {
+        qWarning() << "Unable to read session log" << m_path << ":" << reader.errorString();
+        return false;
+    }
+    QByteArray chunk(readChunkSize, Qt::Uninitialized);
+    QByteArray rest;
+    while (!reader.atEnd()) {
+        auto read = reader.read(chunk.data(), chunk.size());
+        if (read < 0) {
+            qWarning() << "Unable to read session log" << m_path << ":" << reader.errorString();
+            return false;
+        }
+        rest.append(chunk.constData(), read);
+        qsizetype start = 0;
+        for (auto end = rest.indexOf('\n'); end != -1; end = rest.indexOf('\n', start)) {
+            if (!handle(rest.mid(start, end - start)))
+                return true;
+            start = end + 1;
+        }
+        rest.remove(0, start);
+    }
+    return true;
+}
+
+QFuture<QList<SessionLog::Line>> SessionLog::read(qint64 first, int count)
+{
+    submit();
+    return QtConcurrent::run(&m_writerPool, [this, first, count] { return readLines(first, count); });
+}
+
+QList<SessionLog::Line> SessionLog::readLines(qint64 first, int count)
+{
+    QList<Line> lines;
+    auto member = seekableMember(first);
+    auto line = member.firstLine;
+    readRecords(member.offset, [&](const QByteArray& record) {
+        if (line++ >= first)
+            lines.append(decode(record));
+        return lines.size() < count;
+    });
+    return lines;
+}
+
+QFuture<bool> SessionLog::saveTo(const QString& target)
+{
+    submit();
+    return QtConcurrent::run(&m_writerPool, [this, target] { return copyTo(target); });
+}
+
+bool SessionLog::copyTo(const QString& target)
+{
+    auto member = seekableMember(0);
+    QSaveFile output(target);
+    if (!FS::ensureFilePathExists(target) || !output.open(QIODevice::WriteOnly)) {
+        qWarning() << "Unable to save session log" << m_path << "to" << target << ":" << output.errorString();
+        return false;
+    }
+    bool written = true;
+    auto read = readRecords(member.offset, [&](const QByteArray& record) {
+        auto text = decode(record).text.toUtf8() + '\n';
+        written = output.write(text) == text.size();
+        return written;
+    });
+    if (!read || !written) {
+        qWarning() << "Unable to save session log" << m_path << "to" << target << ":" << output.errorString();
+        return false;
+    }
+    return output.commit();
+}
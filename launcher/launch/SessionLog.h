@@ -0,0 +1,95 @@
+#pragma once
+
+#include <QFile>
+#include <QFuture>
+#include <QList>
+#include <QMutex>
+#include <QObject>
+#include <QThreadPool>
+#include <QTimer>
+#include <QVector>
+
+#include <functional>
+#include <memory>
+
+#include "MessageLevel.h"
+
+class GZipWriter;
+
+/**
+ * Append-only, gzip compressed copy of everything logged during a launch.
+ *
+ * Lines are collected on the calling thread and handed to a single writer thread in batches, so the whole
+ * session ends up on disk while LogModel only keeps a window of it in memory.
+ * The file is a sequence of gzip members, every finished member can be read back while the game is running.
+ * Every line is stored with its level in front of it, so lines read back look the same as when they were logged.
+ */
+class SessionLog : public QObject {
+    Q_OBJECT
+   public:
+    struct Line {
+        MessageLevel::Enum level;
+        QString text;
+    };
+
+    explicit SessionLog(const QString& path, QObject* parent = nullptr);
+    virtual ~SessionLog();
+
+    QString path() const { return m_path; }
+
+    /// where the sessions of all instances are kept, one file per instance id
+    static QString directory();
+    static QString pathFor(const QString& instanceId);
+
+    /// lines are numbered in the order they are appended, starting at 0
+    void append(MessageLevel::Enum level, const QString& line);
+    qint64 lineCount() const { return m_lineCount; }
+
+    /**
+     * Reads up to 'count' lines starting at line 'first' back from the file.
+     * Lines past the size limit of the session were never written, so fewer lines may come back.
+     */
+    QFuture<QList<Line>> read(qint64 first, int count);
+
+    /**
+     * Writes the whole session as plain text to 'target'.
+     * It runs on the writer thread once everything appended so far is on disk, the caller does not have to wait for it.
+     */
+    QFuture<bool> saveTo(const QString& target);
+
+   private slots:
+    void submit();
+
+   private:
+    struct Member {
+        // where the gzip member starts in the file, and the number of its first line
+        qint64 offset;
+        qint64 firstLine;
+    };
+
+    void writeBatch(const QList<Line>& lines);
+    bool finishMember();
+    /// finishes the member being written and returns the position to start reading at to get to line 'first'
+    Member seekableMember(qint64 first);
+    bool readRecords(qint64 offset, const std::function<bool(const QByteArray&)>& handle);
+    QList<Line> readLines(qint64 first, int count);
+    bool copyTo(const QString& target);
+
+   private:
+    QString m_path;
+    QList<Line> m_pending;
+    qint64 m_lineCount = 0;
+    QTimer m_submitTimer;
+    // one thread keeps the batches in order
+    QThreadPool m_writerPool;
+
+    // only touched on the writer thread, or with the writer pool drained
+    QMutex m_writerLock;
+    QFile m_file;
+    std::unique_ptr<GZipWriter> m_writer;
+    QVector<Member> m_members;
+    qint64 m_linesWritten = 0;
+    qint64 m_memberBytes = 0;
+    qint64 m_totalBytes = 0;
+    bool m_capped = false;
+};
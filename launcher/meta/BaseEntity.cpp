@@ -15,6 +15,8 @@
 
 #include "BaseEntity.h"
 
+#include <QFileInfo>
+
 #include "Exception.h"
 #include "FileSystem.h"
 #include "Json.h"
@@ -31,6 +33,14 @@
 
 namespace Meta {
 
+// how many local files were not hashed again, because their digest was known from the metacache
+static int s_skippedHashes = 0;
+
+static MetaEntryPtr metaCacheEntry(BaseEntity* entity)
+{
+    return APPLICATION->metacache()->getEntry("meta", FS::RemoveInvalidPathChars(entity->localFilename()));
+}
+
 class ParsingValidator : public Net::Validator {
    public: /* con/des */
     ParsingValidator(BaseEntity* entity) : m_entity(entity) {};
@@ -106,6 +116,11 @@ BaseEntity::LoadStatus BaseEntity::status() const
     return m_load_status;
 }
 
+int BaseEntity::skippedHashCount()
+{
+    return s_skippedHashes;
+}
+
 BaseEntityLoadTask::BaseEntityLoadTask(BaseEntity* parent, Net::Mode mode) : m_entity(parent), m_mode(mode) {}
 
 void BaseEntityLoadTask::executeTask()
@@ -119,8 +134,22 @@ void BaseEntityLoadTask::executeTask()
             // read local file if nothing is loaded yet
             if (m_entity->m_load_status == BaseEntity::LoadStatus::NotLoaded || m_entity->m_file_sha256.isEmpty()) {
                 setStatus(tr("Loading local file"));
-                fileData = FS::read(fname);
-                m_entity->m_file_sha256 = Hashing::hash(fileData, Hashing::Algorithm::Sha256);
+                // the digest is only computed again if the file changed since it was recorded
+                QFileInfo info(fname);
+                auto entry = metaCacheEntry(m_entity);
+                auto timestamp = info.lastModified().toMSecsSinceEpoch();
+                auto cachedSha256 = entry ? entry->getSHA256Sum(info.size(), timestamp) : QString();
+                if (!cachedSha256.isEmpty()) {
+                    m_entity->m_file_sha256 = cachedSha256;
+                    s_skippedHashes++;
+                } else {
+                    fileData = FS::read(fname);
+                    m_entity->m_file_sha256 = Hashing::hash(fileData, Hashing::Algorithm::Sha256);
+                    if (entry) {
+                        entry->setSHA256Sum(m_entity->m_file_sha256, info.size(), timestamp);
+                        APPLICATION->metacache()->SaveEventually();
+                    }
+                }
             }
 
             // on online the hash needs to match
@@ -131,6 +160,9 @@ void BaseEntityLoadTask::executeTask()
 
             // load local file
             if (m_entity->m_load_status == BaseEntity::LoadStatus::NotLoaded) {
+                if (fileData.isEmpty()) {
+                    fileData = FS::read(fname);
+                }
                 auto doc = Json::requireDocument(fileData, fname);
                 auto obj = Json::requireObject(doc, fname);
                 m_entity->parse(obj);
@@ -168,9 +200,15 @@ void BaseEntityLoadTask::executeTask()
     m_task->setAskRetry(false);
     connect(m_task.get(), &Task::failed, this, &BaseEntityLoadTask::emitFailed);
     connect(m_task.get(), &Task::succeeded, this, &BaseEntityLoadTask::emitSucceeded);
-    connect(m_task.get(), &Task::succeeded, this, [this]() {
+    connect(m_task.get(), &Task::succeeded, this, [this, entry]() {
         m_entity->m_load_status = BaseEntity::LoadStatus::Remote;
         m_entity->m_file_sha256 = m_entity->m_sha256;
+        // the checksum validator made sure the new file has the expected digest
+        if (!m_entity->m_sha256.isEmpty()) {
+            QFileInfo info(entry->getFullPath());
+            entry->setSHA256Sum(m_entity->m_sha256, info.size(), info.lastModified().toMSecsSinceEpoch());
+            APPLICATION->metacache()->SaveEventually();
+        }
     });
 
     connect(m_task.get(), &Task::progress, this, &Task::setProgress);
@@ -39,6 +39,9 @@ class BaseEntity {
     bool isLoaded() const;
     LoadStatus status() const;
 
+    /// number of local files whose SHA-256 was taken from the metacache instead of hashing them again
+    static int skippedHashCount();
+
     /* for parsers */
     void setSha256(QString sha256);
 
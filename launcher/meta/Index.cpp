@@ -15,12 +15,17 @@
 
 #include "Index.h"
 
+#include <QDebug>
+
 #include "JsonFormat.h"
 #include "QObjectPtr.h"
 #include "VersionList.h"
 #include "meta/BaseEntity.h"
+#include "tasks/ConcurrentTask.h"
 #include "tasks/SequentialTask.h"
 
+#include "Application.h"
+
 namespace Meta {
 Index::Index(QObject* parent) : QAbstractListModel(parent) {}
 Index::Index(const QVector<VersionList::Ptr>& lists, QObject* parent) : QAbstractListModel(parent), m_lists(lists)
@@ -150,13 +155,52 @@ Task::Ptr Index::loadVersion(const QString& uid, const QString& version, Net::Mo
     return loadTask;
 }
 
-Version::Ptr Index::getLoadedVersion(const QString& uid, const QString& version)
+QMap<QString, QSet<QString>> Index::groupVersions(const QList<std::pair<QString, QString>>& versions)
+{
+    QMap<QString, QSet<QString>> wanted;
+    for (auto& [uid, version] : versions) {
+        auto& uidVersions = wanted[uid];
+        if (!version.isEmpty())
+            uidVersions.insert(version);
+    }
+    return wanted;
+}
+
+Task::Ptr Index::loadVersions(const QList<std::pair<QString, QString>>& versions, Net::Mode mode)
 {
-    QEventLoop ev;
-    auto task = loadVersion(uid, version);
-    QObject::connect(task.get(), &Task::finished, &ev, &QEventLoop::quit);
-    task->start();
-    ev.exec();
-    return get(uid, version);
+    const auto wanted = groupVersions(versions);
+
+    auto maxConcurrent = APPLICATION->settings()->get("NumberOfConcurrentTasks").toInt();
+    auto loadTask = makeShared<SequentialTask>(
+        this, tr("Load meta for %n component(s)", "This is for the task name that loads the meta index.", wanted.size()));
+    if (mode == Net::Mode::Online && status() != BaseEntity::LoadStatus::Remote) {
+        loadTask->addTask(this->loadTask(mode));
+    }
+    auto listsTask = makeShared<ConcurrentTask>(this, tr("Load version lists"), maxConcurrent);
+    for (auto iter = wanted.begin(); iter != wanted.end(); iter++) {
+        auto versionList = get(iter.key());
+        auto versionsTask = makeShared<ConcurrentTask>(this, tr("Load versions of %1").arg(iter.key()), maxConcurrent);
+        for (auto& version : iter.value()) {
+            versionsTask->addTask(versionList->getVersion(version)->loadTask(mode));
+        }
+        // offline, versions are loaded from disk as they are, without needing the checksums from the list
+        if (mode == Net::Mode::Offline && !iter.value().isEmpty()) {
+            listsTask->addTask(versionsTask);
+            continue;
+        }
+        auto uidTask = makeShared<SequentialTask>(this, tr("Load meta for %1").arg(iter.key()));
+        uidTask->addTask(versionList->loadTask(mode));
+        if (!iter.value().isEmpty()) {
+            uidTask->addTask(versionsTask);
+        }
+        listsTask->addTask(uidTask);
+    }
+    loadTask->addTask(listsTask);
+    auto skippedBefore = BaseEntity::skippedHashCount();
+    connect(loadTask.get(), &Task::finished, this, [skippedBefore] {
+        qDebug() << "Meta load finished," << BaseEntity::skippedHashCount() - skippedBefore
+                 << "local file(s) reused the digest recorded in the metacache";
+    });
+    return loadTask;
 }
 }  // namespace Meta
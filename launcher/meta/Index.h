@@ -16,6 +16,8 @@
 #pragma once
 
 #include <QAbstractListModel>
+#include <QMap>
+#include <QSet>
 
 #include "BaseEntity.h"
 #include "meta/VersionList.h"
@@ -50,8 +52,15 @@ class Index : public QAbstractListModel, public BaseEntity {
 
     Task::Ptr loadVersion(const QString& uid, const QString& version = {}, Net::Mode mode = Net::Mode::Online, bool force = false);
 
-    // this blocks until the version is loaded
-    Version::Ptr getLoadedVersion(const QString& uid, const QString& version);
+    /**
+     * Loads all the given (uid, version) pairs concurrently, an empty version only loads the version list of the uid.
+     * The index and every version list and version are loaded only once, no matter how often they are requested.
+     * Once the task finishes, the loaded versions can be looked up with get().
+     */
+    Task::Ptr loadVersions(const QList<std::pair<QString, QString>>& versions, Net::Mode mode = Net::Mode::Online);
+
+    /// the versions loadVersions() loads for the given pairs, per uid and without duplicates
+    static QMap<QString, QSet<QString>> groupVersions(const QList<std::pair<QString, QString>>& versions);
 
    public:  // for usage by parsers only
     void merge(const std::shared_ptr<Index>& other);
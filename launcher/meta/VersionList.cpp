@@ -277,17 +277,6 @@ BaseVersion::Ptr VersionList::getRecommended() const
     return m_recommended;
 }
 
-void VersionList::waitToLoad()
-{
-    if (isLoaded())
-        return;
-    QEventLoop ev;
-    auto task = getLoadTask();
-    QObject::connect(task.get(), &Task::finished, &ev, &QEventLoop::quit);
-    task->start();
-    ev.exec();
-}
-
 Version::Ptr VersionList::getRecommendedForParent(const QString& uid, const QString& version)
 {
     auto foundExplicit = std::find_if(m_versions.begin(), m_versions.end(), [uid, version](Version::Ptr ver) -> bool {
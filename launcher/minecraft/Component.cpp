@@ -222,12 +222,10 @@ bool Component::isMoveable()
     return true;
 }
 
-bool Component::isVersionChangeable(bool wait)
+bool Component::isVersionChangeable()
 {
     auto list = getVersionList();
     if (list) {
-        if (wait)
-            list->waitToLoad();
         return list->count() != 0;
     }
     return false;
@@ -450,12 +448,11 @@ void Component::updateCachedData()
     }
 }
 
-void Component::waitLoadMeta()
+void Component::applyLoadedMeta()
 {
     if (!m_loaded) {
         if (!m_metaVersion || !m_metaVersion->isLoaded()) {
-            // wait for the loaded version from meta
-            m_metaVersion = APPLICATION->metadataIndex()->getLoadedVersion(m_uid, m_version);
+            m_metaVersion = APPLICATION->metadataIndex()->get(m_uid, m_version);
         }
         m_loaded = true;
         updateCachedData();
@@ -72,7 +72,7 @@ class Component : public QObject, public ProblemProvider {
     bool isRevertible();
     bool isRemovable();
     bool isCustom();
-    bool isVersionChangeable(bool wait = true);
+    bool isVersionChangeable();
     bool isKnownModloader();
     QStringList knownConflictingComponents();
 
@@ -104,7 +104,8 @@ class Component : public QObject, public ProblemProvider {
 
     void updateCachedData();
 
-    void waitLoadMeta();
+    /// picks up the meta of the current version, once it was loaded by Meta::Index::loadVersions()
+    void applyLoadedMeta();
 
     void setUpdateAction(UpdateAction action);
     void clearUpdateAction();
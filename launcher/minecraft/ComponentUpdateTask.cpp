@@ -65,7 +65,7 @@ LoadResult composeLoadResult(LoadResult a, LoadResult b)
     return a;
 }
 
-static LoadResult loadComponent(ComponentPtr component, Task::Ptr& loadTask, Net::Mode netmode)
+static LoadResult loadComponent(ComponentPtr component)
 {
     if (component->m_loaded) {
         qCDebug(instanceProfileResolveC) << component->getName() << "is already loaded";
@@ -99,14 +99,8 @@ static LoadResult loadComponent(ComponentPtr component, Task::Ptr& loadTask, Net
             component->m_loaded = true;
             result = LoadResult::LoadedLocal;
         } else {
-            loadTask = APPLICATION->metadataIndex()->loadVersion(component->m_uid, component->m_version, netmode);
-            loadTask->start();
-            if (netmode == Net::Mode::Online)
-                result = LoadResult::RequiresRemote;
-            else if (metaVersion->isLoaded())
-                result = LoadResult::LoadedLocal;
-            else
-                result = LoadResult::Failed;
+            // loaded together with all the other components, see ComponentUpdateTask::loadComponents()
+            result = LoadResult::RequiresRemote;
         }
     }
     return result;
@@ -144,67 +138,41 @@ static LoadResult loadPackProfile(ComponentPtr component, Task::Ptr& loadTask, N
 void ComponentUpdateTask::loadComponents()
 {
     LoadResult result = LoadResult::LoadedLocal;
-    size_t taskIndex = 0;
-    size_t componentIndex = 0;
-    d->remoteLoadSuccessful = true;
+    d->remoteComponents.clear();
 
-    // load all the components OR their lists...
+    // load all the components...
     for (auto component : d->m_profile->d->components) {
-        Task::Ptr loadTask;
-        LoadResult singleResult;
-        RemoteLoadStatus::Type loadType;
         component->resetComponentProblems();
         // FIXME: to do this right, we need to load the lists and decide on which versions to use during dependency resolution. For now,
         // ignore all that...
-#if 0
-        switch(d->mode)
-        {
-            case Mode::Launch:
-            {
-                singleResult = loadComponent(component, loadTask, d->netmode);
-                loadType = RemoteLoadStatus::Type::Version;
-                break;
-            }
-            case Mode::Resolution:
-            {
-                singleResult = loadPackProfile(component, loadTask, d->netmode);
-                loadType = RemoteLoadStatus::Type::List;
-                break;
-            }
-        }
-#else
-        singleResult = loadComponent(component, loadTask, d->netmode);
-        loadType = RemoteLoadStatus::Type::Version;
-#endif
+        auto singleResult = loadComponent(component);
         if (singleResult == LoadResult::LoadedLocal) {
             component->updateCachedData();
+        } else if (singleResult == LoadResult::RequiresRemote) {
+            d->remoteComponents.append(component);
         }
         result = composeLoadResult(result, singleResult);
-        if (loadTask) {
-            qCDebug(instanceProfileResolveC) << d->m_profile->d->m_instance->name() << "|"
-                                             << "Remote loading is being run for" << component->getName();
-            connect(loadTask.get(), &Task::succeeded, this, [this, taskIndex]() { remoteLoadSucceeded(taskIndex); });
-            connect(loadTask.get(), &Task::failed, this, [this, taskIndex](const QString& error) { remoteLoadFailed(taskIndex, error); });
-            connect(loadTask.get(), &Task::aborted, this, [this, taskIndex]() { remoteLoadFailed(taskIndex, tr("Aborted")); });
-            RemoteLoadStatus status;
-            status.type = loadType;
-            status.PackProfileIndex = componentIndex;
-            status.task = loadTask;
-            d->remoteLoadStatusList.append(status);
-            taskIndex++;
-        }
-        componentIndex++;
     }
-    d->remoteTasksInProgress = taskIndex;
     switch (result) {
         case LoadResult::LoadedLocal: {
             // Everything got loaded. Advance to dependency resolution.
-            performUpdateActions();
-            resolveDependencies(d->mode == Mode::Launch || d->netmode == Net::Mode::Offline);
+            performUpdateActions(d->mode == Mode::Launch || d->netmode == Net::Mode::Offline);
             break;
         }
         case LoadResult::RequiresRemote: {
-            // we wait for signals.
+            // load the metadata of all the components in one job, and wait for it
+            QList<std::pair<QString, QString>> versions;
+            for (auto component : d->remoteComponents) {
+                qCDebug(instanceProfileResolveC) << d->m_profile->d->m_instance->name() << "|"
+                                                 << "Remote loading is being run for" << component->getName();
+                versions.append({ component->m_uid, component->m_version });
+            }
+            d->remoteLoadError.clear();
+            d->remoteLoadTask = APPLICATION->metadataIndex()->loadVersions(versions, d->netmode);
+            connect(d->remoteLoadTask.get(), &Task::failed, this, [this](const QString& error) { d->remoteLoadError = error; });
+            connect(d->remoteLoadTask.get(), &Task::aborted, this, [this]() { d->remoteLoadError = tr("Aborted"); });
+            connect(d->remoteLoadTask.get(), &Task::finished, this, &ComponentUpdateTask::remoteLoadFinished);
+            d->remoteLoadTask->start();
             break;
         }
         case LoadResult::Failed: {
@@ -544,100 +512,126 @@ struct overload : Ts... {
 template <class... Ts>
 overload(Ts...) -> overload<Ts...>;
 
-void ComponentUpdateTask::performUpdateActions()
+void ComponentUpdateTask::performUpdateActions(bool checkOnly)
+{
+    // take the actions of this pass, anything they add is handled by the next pass
+    d->pendingActions.clear();
+    QList<std::pair<QString, QString>> toLoad;
+    for (auto component : d->m_profile->d->components) {
+        if (!component) {
+            continue;
+        }
+        auto action = component->getUpdateAction();
+        component->clearUpdateAction();
+        if (std::holds_alternative<UpdateActionNone>(action)) {
+            continue;
+        }
+        if (auto cv = std::get_if<UpdateActionChangeVersion>(&action)) {
+            toLoad.append({ component->getID(), cv->targetVersion });
+        } else if (std::holds_alternative<UpdateActionLatestRecommendedCompatible>(action)) {
+            toLoad.append({ component->getID(), QString() });
+        } else if (auto ic = std::get_if<UpdateActionImportantChanged>(&action)) {
+            toLoad.append({ component->getID(), ic->oldVersion });
+        }
+        d->pendingActions.append({ component, action });
+    }
+
+    if (d->pendingActions.isEmpty()) {
+        resolveDependencies(checkOnly);
+        return;
+    }
+    if (toLoad.isEmpty()) {
+        applyUpdateActions(checkOnly);
+        return;
+    }
+    // load everything the actions need at once, failures are reported on the components as the actions are applied
+    d->metaLoadTask = APPLICATION->metadataIndex()->loadVersions(toLoad);
+    connect(d->metaLoadTask.get(), &Task::finished, this, [this, checkOnly] {
+        d->metaLoadTask.reset();
+        applyUpdateActions(checkOnly);
+    });
+    d->metaLoadTask->start();
+}
+
+void ComponentUpdateTask::applyUpdateActions(bool checkOnly)
 {
     auto& instance = d->m_profile->d->m_instance;
-    bool addedActions;
+    auto& componentIndex = d->m_profile->d->componentIndex;
     QStringList toRemove;
-    do {
-        addedActions = false;
-        toRemove.clear();
-        auto& components = d->m_profile->d->components;
-        auto& componentIndex = d->m_profile->d->componentIndex;
-        for (auto component : components) {
-            if (!component) {
-                continue;
-            }
-            auto action = component->getUpdateAction();
-            auto visitor =
-                overload{ [](const UpdateActionNone&) {
-                             // noop
-                         },
-                          [&component, &instance](const UpdateActionChangeVersion& cv) {
-                              qCDebug(instanceProfileResolveC) << instance->name() << "|"
-                                                               << "UpdateActionChangeVersion" << component->getID() << ":"
-                                                               << component->getVersion() << "change to" << cv.targetVersion;
-                              component->setVersion(cv.targetVersion);
-                              component->waitLoadMeta();
-                          },
-                          [&component, &instance](const UpdateActionLatestRecommendedCompatible lrc) {
-                              qCDebug(instanceProfileResolveC)
-                                  << instance->name() << "|"
-                                  << "UpdateActionLatestRecommendedCompatible" << component->getID() << ":" << component->getVersion()
-                                  << "updating to latest recommend or compatible with" << lrc.parentUid << lrc.version;
-                              auto versionList = APPLICATION->metadataIndex()->get(component->getID());
-                              if (versionList) {
-                                  versionList->waitToLoad();
-                                  auto recommended = versionList->getRecommendedForParent(lrc.parentUid, lrc.version);
-                                  if (!recommended) {
-                                      recommended = versionList->getLatestForParent(lrc.parentUid, lrc.version);
-                                  }
-                                  if (recommended) {
-                                      component->setVersion(recommended->version());
-                                      component->waitLoadMeta();
-                                      return;
-                                  } else {
-                                      component->addComponentProblem(ProblemSeverity::Error,
-                                                                     QObject::tr("No compatible version of %1 found for %2 %3")
-                                                                         .arg(component->getName(), lrc.parentName, lrc.version));
-                                  }
+    // components that switched to a version picked from a version list, which still needs loading
+    QList<ComponentPtr> toLoadMeta;
+    for (auto& pending : d->pendingActions) {
+        auto component = pending.first;
+        auto visitor =
+            overload{ [](const UpdateActionNone&) {
+                         // noop
+                     },
+                      [&component, &instance](const UpdateActionChangeVersion& cv) {
+                          qCDebug(instanceProfileResolveC) << instance->name() << "|"
+                                                           << "UpdateActionChangeVersion" << component->getID() << ":"
+                                                           << component->getVersion() << "change to" << cv.targetVersion;
+                          component->setVersion(cv.targetVersion);
+                          component->applyLoadedMeta();
+                      },
+                      [&component, &instance, &toLoadMeta](const UpdateActionLatestRecommendedCompatible lrc) {
+                          qCDebug(instanceProfileResolveC)
+                              << instance->name() << "|"
+                              << "UpdateActionLatestRecommendedCompatible" << component->getID() << ":" << component->getVersion()
+                              << "updating to latest recommend or compatible with" << lrc.parentUid << lrc.version;
+                          auto versionList = APPLICATION->metadataIndex()->get(component->getID());
+                          if (versionList) {
+                              auto recommended = versionList->getRecommendedForParent(lrc.parentUid, lrc.version);
+                              if (!recommended) {
+                                  recommended = versionList->getLatestForParent(lrc.parentUid, lrc.version);
+                              }
+                              if (recommended) {
+                                  component->setVersion(recommended->version());
+                                  toLoadMeta.append(component);
+                                  return;
                               } else {
-                                  component->addComponentProblem(
-                                      ProblemSeverity::Error,
-                                      QObject::tr("No version list in metadata index for %1").arg(component->getID()));
+                                  component->addComponentProblem(ProblemSeverity::Error,
+                                                                 QObject::tr("No compatible version of %1 found for %2 %3")
+                                                                     .arg(component->getName(), lrc.parentName, lrc.version));
                               }
-                          },
-                          [&component, &instance, &toRemove](const UpdateActionRemove&) {
-                              qCDebug(instanceProfileResolveC)
-                                  << instance->name() << "|"
-                                  << "UpdateActionRemove" << component->getID() << ":" << component->getVersion() << "removing";
-                              toRemove.append(component->getID());
-                          },
-                          [this, &component, &instance, &addedActions, &componentIndex](const UpdateActionImportantChanged& ic) {
-                              qCDebug(instanceProfileResolveC)
-                                  << instance->name() << "|"
-                                  << "UpdateImportantChanged" << component->getID() << ":" << component->getVersion() << "was changed from"
-                                  << ic.oldVersion << "updating linked components";
-                              auto oldVersion = APPLICATION->metadataIndex()->getLoadedVersion(component->getID(), ic.oldVersion);
-                              for (auto oldReq : oldVersion->requiredSet()) {
-                                  auto currentlyRequired = component->m_cachedRequires.find(oldReq);
-                                  if (currentlyRequired == component->m_cachedRequires.cend()) {
-                                      auto oldReqComp = componentIndex.find(oldReq.uid);
-                                      if (oldReqComp != componentIndex.cend()) {
-                                          (*oldReqComp)->setUpdateAction(UpdateAction{ UpdateActionRemove{} });
-                                          addedActions = true;
-                                      }
+                          } else {
+                              component->addComponentProblem(
+                                  ProblemSeverity::Error,
+                                  QObject::tr("No version list in metadata index for %1").arg(component->getID()));
+                          }
+                      },
+                      [&component, &instance, &toRemove](const UpdateActionRemove&) {
+                          qCDebug(instanceProfileResolveC)
+                              << instance->name() << "|"
+                              << "UpdateActionRemove" << component->getID() << ":" << component->getVersion() << "removing";
+                          toRemove.append(component->getID());
+                      },
+                      [this, &component, &instance, &componentIndex](const UpdateActionImportantChanged& ic) {
+                          qCDebug(instanceProfileResolveC)
+                              << instance->name() << "|"
+                              << "UpdateImportantChanged" << component->getID() << ":" << component->getVersion() << "was changed from"
+                              << ic.oldVersion << "updating linked components";
+                          auto oldVersion = APPLICATION->metadataIndex()->get(component->getID(), ic.oldVersion);
+                          for (auto oldReq : oldVersion->requiredSet()) {
+                              auto currentlyRequired = component->m_cachedRequires.find(oldReq);
+                              if (currentlyRequired == component->m_cachedRequires.cend()) {
+                                  auto oldReqComp = componentIndex.find(oldReq.uid);
+                                  if (oldReqComp != componentIndex.cend()) {
+                                      (*oldReqComp)->setUpdateAction(UpdateAction{ UpdateActionRemove{} });
                                   }
                               }
-                              auto linked = collectTreeLinked(component->getID());
-                              for (auto comp : linked) {
-                                  if (comp->isCustom()) {
-                                      continue;
-                                  }
-                                  auto compUid = comp->getID();
-                                  auto parentReq = std::find_if(component->m_cachedRequires.begin(), component->m_cachedRequires.end(),
-                                                                [compUid](const Meta::Require& req) { return req.uid == compUid; });
-                                  if (parentReq != component->m_cachedRequires.end()) {
-                                      auto newVersion = parentReq->equalsVersion.isEmpty() ? parentReq->suggests : parentReq->equalsVersion;
-                                      if (!newVersion.isEmpty()) {
-                                          comp->setUpdateAction(UpdateAction{ UpdateActionChangeVersion{ newVersion } });
-                                      } else {
-                                          comp->setUpdateAction(UpdateAction{ UpdateActionLatestRecommendedCompatible{
-                                              component->getID(),
-                                              component->getName(),
-                                              component->getVersion(),
-                                          } });
-                                      }
+                          }
+                          auto linked = collectTreeLinked(component->getID());
+                          for (auto comp : linked) {
+                              if (comp->isCustom()) {
+                                  continue;
+                              }
+                              auto compUid = comp->getID();
+                              auto parentReq = std::find_if(component->m_cachedRequires.begin(), component->m_cachedRequires.end(),
+                                                            [compUid](const Meta::Require& req) { return req.uid == compUid; });
+                              if (parentReq != component->m_cachedRequires.end()) {
+                                  auto newVersion = parentReq->equalsVersion.isEmpty() ? parentReq->suggests : parentReq->equalsVersion;
+                                  if (!newVersion.isEmpty()) {
+                                      comp->setUpdateAction(UpdateAction{ UpdateActionChangeVersion{ newVersion } });
                                   } else {
                                       comp->setUpdateAction(UpdateAction{ UpdateActionLatestRecommendedCompatible{
                                           component->getID(),
@@ -645,16 +639,42 @@ void ComponentUpdateTask::performUpdateActions()
                                           component->getVersion(),
                                       } });
                                   }
-                                  addedActions = true;
+                              } else {
+                                  comp->setUpdateAction(UpdateAction{ UpdateActionLatestRecommendedCompatible{
+                                      component->getID(),
+                                      component->getName(),
+                                      component->getVersion(),
+                                  } });
                               }
-                          } };
-            std::visit(visitor, action);
-            component->clearUpdateAction();
-            for (auto uid : toRemove) {
-                d->m_profile->remove(uid);
-            }
+                          }
+                      } };
+        std::visit(visitor, pending.second);
+    }
+    d->pendingActions.clear();
+    for (auto uid : toRemove) {
+        d->m_profile->remove(uid);
+    }
+
+    auto nextPass = [this, checkOnly, toLoadMeta] {
+        for (auto component : toLoadMeta) {
+            component->applyLoadedMeta();
         }
-    } while (addedActions);
+        performUpdateActions(checkOnly);
+    };
+    if (toLoadMeta.isEmpty()) {
+        nextPass();
+        return;
+    }
+    QList<std::pair<QString, QString>> versions;
+    for (auto component : toLoadMeta) {
+        versions.append({ component->getID(), component->getVersion() });
+    }
+    d->metaLoadTask = APPLICATION->metadataIndex()->loadVersions(versions);
+    connect(d->metaLoadTask.get(), &Task::finished, this, [this, nextPass] {
+        d->metaLoadTask.reset();
+        nextPass();
+    });
+    d->metaLoadTask->start();
 }
 
 void ComponentUpdateTask::finalizeComponents()
@@ -703,77 +723,30 @@ void ComponentUpdateTask::finalizeComponents()
     }
 }
 
-void ComponentUpdateTask::remoteLoadSucceeded(size_t taskIndex)
-{
-    if (static_cast<size_t>(d->remoteLoadStatusList.size()) < taskIndex) {
-        qCWarning(instanceProfileResolveC) << "Got task index outside of results" << taskIndex;
-        return;
-    }
-    auto& taskSlot = d->remoteLoadStatusList[taskIndex];
-    disconnect(taskSlot.task.get(), &Task::succeeded, this, nullptr);
-    disconnect(taskSlot.task.get(), &Task::failed, this, nullptr);
-    disconnect(taskSlot.task.get(), &Task::aborted, this, nullptr);
-    if (taskSlot.finished) {
-        qCWarning(instanceProfileResolveC) << "Got multiple results from remote load task" << taskIndex;
-        return;
-    }
-    qCDebug(instanceProfileResolveC) << "Remote task" << taskIndex << "succeeded";
-    taskSlot.succeeded = false;
-    taskSlot.finished = true;
-    d->remoteTasksInProgress--;
-    // update the cached data of the component from the downloaded version file.
-    if (taskSlot.type == RemoteLoadStatus::Type::Version) {
-        auto component = d->m_profile->getComponent(taskSlot.PackProfileIndex);
-        component->m_loaded = true;
-        component->updateCachedData();
-    }
-    checkIfAllFinished();
-}
-
-void ComponentUpdateTask::remoteLoadFailed(size_t taskIndex, const QString& msg)
+void ComponentUpdateTask::remoteLoadFinished()
 {
-    if (static_cast<size_t>(d->remoteLoadStatusList.size()) < taskIndex) {
-        qCWarning(instanceProfileResolveC) << "Got task index outside of results" << taskIndex;
-        return;
+    d->remoteLoadTask.reset();
+    QStringList missing;
+    for (auto component : d->remoteComponents) {
+        // update the cached data of the component from the downloaded version file.
+        if (component->m_metaVersion && component->m_metaVersion->isLoaded()) {
+            component->m_loaded = true;
+            component->updateCachedData();
+        } else {
+            missing.append(component->getName());
+        }
     }
-    auto& taskSlot = d->remoteLoadStatusList[taskIndex];
-    disconnect(taskSlot.task.get(), &Task::succeeded, this, nullptr);
-    disconnect(taskSlot.task.get(), &Task::failed, this, nullptr);
-    disconnect(taskSlot.task.get(), &Task::aborted, this, nullptr);
-    if (taskSlot.finished) {
-        qCWarning(instanceProfileResolveC) << "Got multiple results from remote load task" << taskIndex;
+    d->remoteComponents.clear();
+    if (missing.isEmpty()) {
+        // nothing bad happened... proceed with looking at dependencies
+        performUpdateActions(d->mode == Mode::Launch || d->netmode == Net::Mode::Offline);
         return;
     }
-    qCDebug(instanceProfileResolveC) << "Remote task" << taskIndex << "failed: " << msg;
-    d->remoteLoadSuccessful = false;
-    taskSlot.succeeded = false;
-    taskSlot.finished = true;
-    taskSlot.error = msg;
-    d->remoteTasksInProgress--;
-    checkIfAllFinished();
-}
-
-void ComponentUpdateTask::checkIfAllFinished()
-{
-    if (d->remoteTasksInProgress) {
-        // not yet...
+    qCDebug(instanceProfileResolveC) << "Remote loading failed for" << missing << ":" << d->remoteLoadError;
+    if (d->netmode == Net::Mode::Offline) {
+        emitFailed(tr("Some component metadata load tasks failed."));
         return;
     }
-    if (d->remoteLoadSuccessful) {
-        // nothing bad happened... clear the temp load status and proceed with looking at dependencies
-        d->remoteLoadStatusList.clear();
-        performUpdateActions();
-        resolveDependencies(d->mode == Mode::Launch);
-    } else {
-        // remote load failed... report error and bail
-        QStringList allErrorsList;
-        for (auto& item : d->remoteLoadStatusList) {
-            if (!item.succeeded) {
-                allErrorsList.append(item.error);
-            }
-        }
-        auto allErrors = allErrorsList.join("\n");
-        emitFailed(tr("Component metadata update task failed while downloading from remote server:\n%1").arg(allErrors));
-        d->remoteLoadStatusList.clear();
-    }
+    auto error = d->remoteLoadError.isEmpty() ? tr("Could not load %1").arg(missing.join(", ")) : d->remoteLoadError;
+    emitFailed(tr("Component metadata update task failed while downloading from remote server:\n%1").arg(error));
 }
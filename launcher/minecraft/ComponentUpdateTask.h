@@ -25,12 +25,12 @@ class ComponentUpdateTask : public Task {
     /// collects components that are dependent on or dependencies of the component
     QList<ComponentPtr> collectTreeLinked(const QString& uid);
     void resolveDependencies(bool checkOnly);
-    void performUpdateActions();
+    /// runs the pending update actions in passes, loading the metadata each pass needs first, then resolves dependencies
+    void performUpdateActions(bool checkOnly);
+    void applyUpdateActions(bool checkOnly);
     void finalizeComponents();
 
-    void remoteLoadSucceeded(size_t index);
-    void remoteLoadFailed(size_t index, const QString& msg);
-    void checkIfAllFinished();
+    void remoteLoadFinished();
 
    private:
     std::unique_ptr<ComponentUpdateTaskData> d;
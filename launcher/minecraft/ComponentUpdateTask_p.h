@@ -3,6 +3,7 @@
 #include <QList>
 #include <QString>
 #include <cstddef>
+#include <utility>
 #include "net/Mode.h"
 #include "tasks/Task.h"
 
@@ -10,20 +11,15 @@
 
 class PackProfile;
 
-struct RemoteLoadStatus {
-    enum class Type { Index, List, Version } type = Type::Version;
-    size_t PackProfileIndex = 0;
-    bool finished = false;
-    bool succeeded = false;
-    QString error;
-    Task::Ptr task;
-};
-
 struct ComponentUpdateTaskData {
     PackProfile* m_profile = nullptr;
-    QList<RemoteLoadStatus> remoteLoadStatusList;
-    bool remoteLoadSuccessful = true;
-    size_t remoteTasksInProgress = 0;
+    // components whose metadata is being loaded, all by the same task
+    QList<ComponentPtr> remoteComponents;
+    Task::Ptr remoteLoadTask;
+    QString remoteLoadError;
     ComponentUpdateTask::Mode mode;
     Net::Mode netmode;
+    // update actions of the current pass and the metadata load they wait for
+    QList<std::pair<ComponentPtr, UpdateAction>> pendingActions;
+    Task::Ptr metaLoadTask;
 };
@@ -228,32 +228,62 @@ QList<Net::NetRequest::Ptr> Library::getDownloads(const RuntimeContext& runtimeC
 }
 
 /**
- * @brief Check if the library is active in the given runtime context.
+ * @brief Evaluate the rules and native classifiers of the library for a runtime context.
  *
- * This function evaluates rules to determine if the library should be active,
- * considering both general rules and native compatibility.
+ * Libraries are checked over and over while building the profile, downloading and launching,
+ * so the result for the last runtime context is kept and reused as long as that context stays the same.
  *
  * @param runtimeContext The current runtime context.
- * @return bool True if the library is active, false otherwise.
+ * @return const Evaluation& Whether the library is active and its compatible native classifier.
  */
-bool Library::isActive(const RuntimeContext& runtimeContext) const
+const Library::Evaluation& Library::evaluate(const RuntimeContext& runtimeContext) const
 {
+    if (m_evaluation && m_evaluation->runtimeContext == runtimeContext) {
+        return *m_evaluation;
+    }
+
+    Evaluation evaluation;
+    evaluation.runtimeContext = runtimeContext;
+
+    // try to match precise classifier "[os]-[arch]"
+    auto entry = m_nativeClassifiers.constFind(runtimeContext.getClassifier());
+    // try to match imprecise classifier on legacy architectures "[os]"
+    if (entry == m_nativeClassifiers.constEnd() && runtimeContext.isLegacyArch())
+        entry = m_nativeClassifiers.constFind(runtimeContext.system);
+    if (entry != m_nativeClassifiers.constEnd())
+        evaluation.nativeClassifier = entry.value();
+
     bool result = true;
-    if (m_rules.empty()) {
-        result = true;
-    } else {
+    if (!m_rules.empty()) {
         RuleAction ruleResult = Disallow;
         for (auto rule : m_rules) {
             RuleAction temp = rule->apply(this, runtimeContext);
             if (temp != Defer)
                 ruleResult = temp;
         }
-        result = result && (ruleResult == Allow);
+        result = ruleResult == Allow;
     }
     if (isNative()) {
-        result = result && !getCompatibleNative(runtimeContext).isNull();
+        result = result && !evaluation.nativeClassifier.isNull();
     }
-    return result;
+    evaluation.active = result;
+
+    m_evaluation = evaluation;
+    return *m_evaluation;
+}
+
+/**
+ * @brief Check if the library is active in the given runtime context.
+ *
+ * This function evaluates rules to determine if the library should be active,
+ * considering both general rules and native compatibility.
+ *
+ * @param runtimeContext The current runtime context.
+ * @return bool True if the library is active, false otherwise.
+ */
+bool Library::isActive(const RuntimeContext& runtimeContext) const
+{
+    return evaluate(runtimeContext).active;
 }
 
 /**
@@ -287,16 +317,7 @@ bool Library::isAlwaysStale() const
  */
 QString Library::getCompatibleNative(const RuntimeContext& runtimeContext) const
 {
-    // try to match precise classifier "[os]-[arch]"
-    auto entry = m_nativeClassifiers.constFind(runtimeContext.getClassifier());
-    // try to match imprecise classifier on legacy architectures "[os]"
-    if (entry == m_nativeClassifiers.constEnd() && runtimeContext.isLegacyArch())
-        entry = m_nativeClassifiers.constFind(runtimeContext.system);
-
-    if (entry == m_nativeClassifiers.constEnd())
-        return QString();
-
-    return entry.value();
+    return evaluate(runtimeContext).nativeClassifier;
 }
 
 /**
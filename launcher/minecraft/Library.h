@@ -42,6 +42,7 @@
 #include <QStringList>
 #include <QUrl>
 #include <memory>
+#include <optional>
 
 #include "GradleSpecifier.h"
 #include "MojangDownloadInfo.h"
@@ -71,8 +72,8 @@ class Library {
         newlib->m_hint = base->m_hint;
         newlib->m_absoluteURL = base->m_absoluteURL;
         newlib->m_extractExcludes = base->m_extractExcludes;
-        newlib->m_nativeClassifiers = base->m_nativeClassifiers;
-        newlib->m_rules = base->m_rules;
+        newlib->setNativeClassifiers(base->m_nativeClassifiers);
+        newlib->setRules(base->m_rules);
         newlib->m_storagePrefix = base->m_storagePrefix;
         newlib->m_mojangDownloads = base->m_mojangDownloads;
         newlib->m_filename = base->m_filename;
@@ -99,6 +100,16 @@ class Library {
     /// Returns true if the library is native
     bool isNative() const { return m_nativeClassifiers.size() != 0; }
 
+    /// native suffixes per OS
+    const QMap<QString, QString>& nativeClassifiers() const { return m_nativeClassifiers; }
+
+    /// Set the native suffixes per OS
+    void setNativeClassifiers(const QMap<QString, QString>& classifiers)
+    {
+        m_nativeClassifiers = classifiers;
+        m_evaluation.reset();
+    }
+
     void setStoragePrefix(QString prefix = QString());
 
     /// Set the url base for downloads
@@ -128,8 +139,15 @@ class Library {
 
     void setHint(const QString& hint) { m_hint = hint; }
 
+    /// rules associated with the library
+    const QList<std::shared_ptr<Rule>>& rules() const { return m_rules; }
+
     /// Set the load rules
-    void setRules(QList<std::shared_ptr<Rule>> rules) { m_rules = rules; }
+    void setRules(QList<std::shared_ptr<Rule>> rules)
+    {
+        m_rules = rules;
+        m_evaluation.reset();
+    }
 
     /// Returns true if the library should be loaded (or extracted, in case of natives)
     bool isActive(const RuntimeContext& runtimeContext) const;
@@ -151,7 +169,18 @@ class Library {
 
     QString getCompatibleNative(const RuntimeContext& runtimeContext) const;
 
+   private: /* types */
+    /// the rules and native classifiers, evaluated for one runtime context
+    struct Evaluation {
+        RuntimeContext runtimeContext;
+        bool active = false;
+        QString nativeClassifier;
+    };
+
    private: /* methods */
+    /// evaluate the rules and native classifiers, or reuse the result if the runtime context did not change
+    const Evaluation& evaluate(const RuntimeContext& runtimeContext) const;
+
     /// the default storage prefix used by Prism Launcher
     static QString defaultStoragePrefix();
 
@@ -196,15 +225,21 @@ class Library {
     /// a list of files that shouldn't be extracted from the library
     QStringList m_extractExcludes;
 
-    /// native suffixes per OS
-    QMap<QString, QString> m_nativeClassifiers;
-
     /// true if the library had a rules section (even empty)
     bool applyRules = false;
 
+    /// MOJANG: container with Mojang style download info
+    MojangLibraryDownloadInfo::Ptr m_mojangDownloads;
+
+   private: /* data */
+    // only changed through the setters, they invalidate m_evaluation
+
+    /// native suffixes per OS
+    QMap<QString, QString> m_nativeClassifiers;
+
     /// rules associated with the library
     QList<std::shared_ptr<Rule>> m_rules;
 
-    /// MOJANG: container with Mojang style download info
-    MojangLibraryDownloadInfo::Ptr m_mojangDownloads;
+    /// the last evaluation, a library is nearly always used with the same runtime context
+    mutable std::optional<Evaluation> m_evaluation;
 };
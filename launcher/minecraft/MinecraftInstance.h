@@ -139,7 +139,7 @@ class MinecraftInstance : public BaseInstance {
     QProcessEnvironment createLaunchEnvironment() override;
 
     /// guess log level from a line of minecraft log
-    MessageLevel::Enum guessLevel(const QString& line, MessageLevel::Enum level) override;
+    std::unique_ptr<LogLevelClassifier> createLogLevelClassifier() const override;
 
     IPathMatcher::Ptr getLogFileMatcher() override;
 
@@ -309,17 +309,19 @@ LibraryPtr MojangVersionFormat::libraryFromJson(ProblemContainer& problems, cons
     }
     if (libObj.contains("natives")) {
         QJsonObject nativesObj = requireObject(libObj.value("natives"));
+        QMap<QString, QString> nativeClassifiers;
         for (auto it = nativesObj.begin(); it != nativesObj.end(); ++it) {
             if (!it.value().isString()) {
                 qWarning() << filename << "contains an invalid native (skipping)";
             }
             // FIXME: Skip unknown platforms
-            out->m_nativeClassifiers[it.key()] = it.value().toString();
+            nativeClassifiers[it.key()] = it.value().toString();
         }
+        out->setNativeClassifiers(nativeClassifiers);
     }
     if (libObj.contains("rules")) {
         out->applyRules = true;
-        out->m_rules = rulesFromJsonV4(libObj);
+        out->setRules(rulesFromJsonV4(libObj));
     }
     if (libObj.contains("downloads")) {
         out->m_mojangDownloads = libDownloadInfoFromJson(libObj);
@@ -336,8 +338,9 @@ QJsonObject MojangVersionFormat::libraryToJson(Library* library)
     }
     if (library->isNative()) {
         QJsonObject nativeList;
-        auto iter = library->m_nativeClassifiers.begin();
-        while (iter != library->m_nativeClassifiers.end()) {
+        auto& nativeClassifiers = library->nativeClassifiers();
+        auto iter = nativeClassifiers.begin();
+        while (iter != nativeClassifiers.end()) {
             nativeList.insert(iter.key(), iter.value());
             iter++;
         }
@@ -352,9 +355,9 @@ QJsonObject MojangVersionFormat::libraryToJson(Library* library)
             libRoot.insert("extract", extract);
         }
     }
-    if (!library->m_rules.isEmpty()) {
+    if (!library->rules().isEmpty()) {
         QJsonArray allRules;
-        for (auto& rule : library->m_rules) {
+        for (auto& rule : library->rules()) {
             QJsonObject ruleObj = rule->toJson();
             allRules.append(ruleObj);
         }
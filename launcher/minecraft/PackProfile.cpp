@@ -942,15 +942,46 @@ bool PackProfile::installAgents_internal(QStringList filepaths)
     return true;
 }
 
+static bool isSameLayer(const LaunchProfileLayer& layer, ComponentPtr component)
+{
+    auto file = component->getVersionFile();
+    auto severity = file ? file->getProblemSeverity() : component->getProblemSeverity();
+    return layer.component == component && layer.file == file && layer.enabled == component->isEnabled() && layer.severity == severity;
+}
+
 std::shared_ptr<LaunchProfile> PackProfile::getProfile() const
 {
     if (!d->m_profile) {
+        auto& layers = d->m_profileLayers;
+        auto runtimeContext = d->m_instance->runtimeContext();
+        if (runtimeContext != d->m_profileLayersContext) {
+            layers.clear();
+            d->m_profileLayersContext = runtimeContext;
+        }
+        // keep the layers up to the first component that changed, only the ones after it need to be applied again
+        qsizetype reused = 0;
+        while (reused < layers.size() && reused < d->components.size() && isSameLayer(layers[reused], d->components[reused])) {
+            reused++;
+        }
+        layers.erase(layers.begin() + reused, layers.end());
+        qCDebug(instanceProfileC) << d->m_instance->name() << "|" << "Reusing" << reused << "of" << d->components.size()
+                                  << "applied components";
         try {
-            auto profile = std::make_shared<LaunchProfile>();
-            for (auto file : d->components) {
+            auto profile = layers.isEmpty() ? std::make_shared<LaunchProfile>() : std::make_shared<LaunchProfile>(*layers.last().profile);
+            for (auto i = reused; i < d->components.size(); i++) {
+                auto file = d->components[i];
                 qCDebug(instanceProfileC) << d->m_instance->name() << "|" << "Applying" << file->getID()
                                           << (file->getProblemSeverity() == ProblemSeverity::Error ? "ERROR" : "GOOD");
                 file->applyTo(profile.get());
+
+                LaunchProfileLayer layer;
+                layer.component = file;
+                layer.file = file->getVersionFile();
+                layer.enabled = file->isEnabled();
+                layer.severity = layer.file ? layer.file->getProblemSeverity() : file->getProblemSeverity();
+                // the containers are implicitly shared, so this copy is cheap
+                layer.profile = std::make_shared<LaunchProfile>(*profile);
+                layers.append(layer);
             }
             d->m_profile = profile;
         } catch (const Exception& error) {
@@ -999,6 +1030,33 @@ QString PackProfile::getComponentVersion(const QString& uid) const
     return QString();
 }
 
+QList<std::pair<QString, QString>> PackProfile::metaVersions()
+{
+    if (!d->loaded && !load()) {
+        return {};
+    }
+    QList<std::pair<QString, QString>> versions;
+    for (auto component : d->components) {
+        if (component->m_version.isEmpty() || QFile::exists(component->getFilename())) {
+            continue;
+        }
+        versions.append({ component->m_uid, component->m_version });
+    }
+    return versions;
+}
+
+Task::Ptr PackProfile::prefetchMeta(const QList<std::shared_ptr<BaseInstance>>& instances, Net::Mode netmode)
+{
+    QList<std::pair<QString, QString>> versions;
+    for (auto& instance : instances) {
+        if (auto minecraft = std::dynamic_pointer_cast<MinecraftInstance>(instance)) {
+            versions.append(minecraft->getPackProfile()->metaVersions());
+        }
+    }
+    // the index takes care of loading every version only once
+    return APPLICATION->metadataIndex()->loadVersions(versions, netmode);
+}
+
 void PackProfile::disableInteraction(bool disable)
 {
     if (d->interactionDisabled != disable) {
@@ -1046,10 +1104,21 @@ std::optional<ModPlatform::ModLoaderTypes> PackProfile::getSupportedModLoaders()
 
 QList<ModPlatform::ModLoaderType> PackProfile::getModLoadersList()
 {
-    QList<ModPlatform::ModLoaderType> result;
+    QStringList enabled;
     for (auto c : d->components) {
-        if (c->isEnabled() && Component::KNOWN_MODLOADERS.contains(c->getID())) {
-            result.append(Component::KNOWN_MODLOADERS[c->getID()].type);
+        if (c->isEnabled()) {
+            enabled.append(c->getID());
+        }
+    }
+    return modLoadersOf(enabled, getComponentVersion("net.minecraft"));
+}
+
+QList<ModPlatform::ModLoaderType> PackProfile::modLoadersOf(const QStringList& enabledComponents, const QString& mcVersion)
+{
+    QList<ModPlatform::ModLoaderType> result;
+    for (auto& uid : enabledComponents) {
+        if (Component::KNOWN_MODLOADERS.contains(uid)) {
+            result.append(Component::KNOWN_MODLOADERS[uid].type);
         }
     }
 
@@ -1057,8 +1126,7 @@ QList<ModPlatform::ModLoaderType> PackProfile::getModLoadersList()
     if (result.contains(ModPlatform::Quilt) && !result.contains(ModPlatform::Fabric)) {
         result.append(ModPlatform::Fabric);
     }
-    if (getComponentVersion("net.minecraft") == "1.20.1" && result.contains(ModPlatform::NeoForge) &&
-        !result.contains(ModPlatform::Forge)) {
+    if (mcVersion == "1.20.1" && result.contains(ModPlatform::NeoForge) && !result.contains(ModPlatform::Forge)) {
         result.append(ModPlatform::Forge);
     }
     return result;
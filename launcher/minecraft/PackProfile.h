@@ -45,12 +45,14 @@
 #include <QString>
 #include <memory>
 #include <optional>
+#include <utility>
 
 #include "Component.h"
 #include "LaunchProfile.h"
 #include "modplatform/ModIndex.h"
 #include "net/Mode.h"
 
+class BaseInstance;
 class MinecraftInstance;
 struct PackProfileData;
 class ComponentUpdateTask;
@@ -117,6 +119,12 @@ class PackProfile : public QAbstractListModel {
 
     QString getComponentVersion(const QString& uid) const;
 
+    /// the (uid, version) pairs of the metadata the components are built from, components with a local file are skipped
+    QList<std::pair<QString, QString>> metaVersions();
+
+    /// loads the metadata of all the given instances in one job, every version shared between them is loaded once
+    static Task::Ptr prefetchMeta(const QList<std::shared_ptr<BaseInstance>>& instances, Net::Mode netmode = Net::Mode::Online);
+
     bool setComponentVersion(const QString& uid, const QString& version, bool important = false);
 
     bool installEmpty(const QString& uid, const QString& name);
@@ -147,6 +155,8 @@ class PackProfile : public QAbstractListModel {
     // this returns aditional loaders(Quilt supports fabric and NeoForge supports Forge)
     std::optional<ModPlatform::ModLoaderTypes> getSupportedModLoaders();
     QList<ModPlatform::ModLoaderType> getModLoadersList();
+    /// same as getModLoadersList(), for the uids of the enabled components of a profile that is not loaded
+    static QList<ModPlatform::ModLoaderType> modLoadersOf(const QStringList& enabledComponents, const QString& mcVersion);
 
     /// apply the component patches. Catches all the errors and returns true/false for success/failure
     void invalidateLaunchProfile();
@@ -4,18 +4,36 @@
 #include <QMap>
 #include <QTimer>
 #include "Component.h"
+#include "LaunchProfile.h"
+#include "RuntimeContext.h"
 #include "tasks/Task.h"
 
 class MinecraftInstance;
+class VersionFile;
 using ComponentContainer = QList<ComponentPtr>;
 using ComponentIndex = QMap<QString, ComponentPtr>;
 
+// one component applied on top of the layers before it, see PackProfile::getProfile()
+struct LaunchProfileLayer {
+    // what was applied, the layer is only reused while all of this is unchanged
+    ComponentPtr component;
+    std::shared_ptr<VersionFile> file;
+    bool enabled = true;
+    ProblemSeverity severity = ProblemSeverity::None;
+
+    // the launch profile with this component and all the ones before it applied
+    std::shared_ptr<LaunchProfile> profile;
+};
+
 struct PackProfileData {
     // the instance this belongs to
     MinecraftInstance* m_instance;
 
     // the launch profile (volatile, temporary thing created on demand)
     std::shared_ptr<LaunchProfile> m_profile;
+    // the launch profile after every component, so it can be composed again starting at the first changed one
+    QList<LaunchProfileLayer> m_profileLayers;
+    RuntimeContext m_profileLayersContext;
 
     // persistent list of components and related machinery
     ComponentContainer components;
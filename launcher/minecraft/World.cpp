@@ -124,10 +124,15 @@ QString GameType::toLogString() const
     return "Undefined";
 }
 
-std::unique_ptr<nbt::tag_compound> parseLevelDat(QByteArray data)
+std::unique_ptr<nbt::tag_compound> parseLevelDat(QIODevice& compressed)
 {
-    QByteArray output;
-    if (!GZip::unzip(data, output)) {
+    GZipReader reader(&compressed);
+    if (!reader.open(QIODevice::ReadOnly)) {
+        return nullptr;
+    }
+    auto output = reader.readAll();
+    if (!reader.atEnd()) {
+        qWarning() << "Unable to decompress level.dat:" << reader.errorString();
         return nullptr;
     }
     std::istringstream foo(std::string(output.constData(), output.size()));
@@ -164,20 +169,7 @@ QString getLevelDatFromFS(const QFileInfo& file)
     return worldDir.absoluteFilePath("level.dat");
 }
 
-QByteArray getLevelDatDataFromFS(const QFileInfo& file)
-{
-    auto fullFilePath = getLevelDatFromFS(file);
-    if (fullFilePath.isNull()) {
-        return QByteArray();
-    }
-    QFile f(fullFilePath);
-    if (!f.open(QIODevice::ReadOnly)) {
-        return QByteArray();
-    }
-    return f.readAll();
-}
-
-bool putLevelDatDataToFS(const QFileInfo& file, QByteArray& data)
+bool putLevelDatDataToFS(const QFileInfo& file, const QByteArray& data)
 {
     auto fullFilePath = getLevelDatFromFS(file);
     if (fullFilePath.isNull()) {
@@ -187,11 +179,8 @@ bool putLevelDatDataToFS(const QFileInfo& file, QByteArray& data)
     if (!f.open(QIODevice::WriteOnly)) {
         return false;
     }
-    QByteArray compressed;
-    if (!GZip::zip(data, compressed)) {
-        return false;
-    }
-    if (f.write(compressed) != compressed.size()) {
+    GZipWriter writer(&f);
+    if (!writer.open(QIODevice::WriteOnly) || writer.write(data) != data.size() || !writer.finish()) {
         f.cancelWriting();
         return false;
     }
@@ -250,12 +239,13 @@ bool World::resetIcon()
 
 void World::readFromFS(const QFileInfo& file)
 {
-    auto bytes = getLevelDatDataFromFS(file);
-    if (bytes.isEmpty()) {
+    auto fullFilePath = getLevelDatFromFS(file);
+    QFile f(fullFilePath);
+    if (fullFilePath.isNull() || !f.open(QIODevice::ReadOnly) || f.size() == 0) {
         is_valid = false;
         return;
     }
-    loadFromLevelDat(bytes);
+    loadFromLevelDat(f);
     levelDatTime = file.lastModified();
 }
 
@@ -289,7 +279,7 @@ void World::readFromZip(const QFileInfo& file)
     if (!is_valid) {
         return;
     }
-    loadFromLevelDat(zippedFile.readAll());
+    loadFromLevelDat(zippedFile);
     zippedFile.close();
 }
 
@@ -327,12 +317,14 @@ bool World::rename(const QString& newName)
         return false;
     }
 
-    auto data = getLevelDatDataFromFS(m_containerFile);
-    if (data.isEmpty()) {
+    auto fullFilePath = getLevelDatFromFS(m_containerFile);
+    QFile levelDat(fullFilePath);
+    if (fullFilePath.isNull() || !levelDat.open(QIODevice::ReadOnly) || levelDat.size() == 0) {
         return false;
     }
 
-    auto worldData = parseLevelDat(data);
+    auto worldData = parseLevelDat(levelDat);
+    levelDat.close();
     if (!worldData) {
         return false;
     }
@@ -342,7 +334,7 @@ bool World::rename(const QString& newName)
     }
     auto& dataCompound = val.as<nbt::tag_compound>();
     dataCompound.put("LevelName", nbt::value_initializer(newName.toUtf8().data()));
-    data = serializeLevelDat(worldData.get());
+    auto data = serializeLevelDat(worldData.get());
 
     putLevelDatDataToFS(m_containerFile, data);
 
@@ -426,9 +418,9 @@ GameType read_gametype(nbt::value& parent, const char* name)
 
 }  // namespace
 
-void World::loadFromLevelDat(QByteArray data)
+void World::loadFromLevelDat(QIODevice& compressed)
 {
-    auto levelData = parseLevelDat(data);
+    auto levelData = parseLevelDat(compressed);
     if (!levelData) {
         is_valid = false;
         return;
@@ -16,6 +16,7 @@
 #pragma once
 #include <QDateTime>
 #include <QFileInfo>
+#include <QIODevice>
 #include <optional>
 
 struct GameType {
@@ -75,7 +76,7 @@ class World {
    private:
     void readFromZip(const QFileInfo& file);
     void readFromFS(const QFileInfo& file);
-    void loadFromLevelDat(QByteArray data);
+    void loadFromLevelDat(QIODevice& compressed);
 
    protected:
     QFileInfo m_containerFile;
@@ -64,7 +64,7 @@ LauncherPartLaunch::LauncherPartLaunch(LaunchTask* parent)
             });
     }
 
-    connect(&m_process, &LoggedProcess::log, this, &LauncherPartLaunch::logLines);
+    connect(&m_process, &LoggedProcess::log, this, &LauncherPartLaunch::onProcessLog);
     connect(&m_process, &LoggedProcess::stateChanged, this, &LauncherPartLaunch::on_state);
 }
 
@@ -157,8 +157,41 @@ void LauncherPartLaunch::executeTask()
 #endif
 }
 
+void LauncherPartLaunch::onProcessLog(const QStringList& lines, MessageLevel::Enum level)
+{
+    // log4j console appenders write to stdout, anything else is plain text
+    if (level != MessageLevel::StdOut) {
+        emit logLines(lines, level);
+        return;
+    }
+    QStringList plain;
+    for (auto& item : m_eventParser.feed(lines)) {
+        if (auto line = std::get_if<QString>(&item)) {
+            plain.append(*line);
+            continue;
+        }
+        if (!plain.isEmpty()) {
+            emit logLines(plain, level);
+            plain.clear();
+        }
+        emit logEvent(std::get<LogEvent>(item));
+    }
+    if (!plain.isEmpty()) {
+        emit logLines(plain, level);
+    }
+}
+
 void LauncherPartLaunch::on_state(LoggedProcess::State state)
 {
+    bool ended = state == LoggedProcess::Finished || state == LoggedProcess::Crashed || state == LoggedProcess::Aborted;
+    if (ended && m_eventParser.isBuffering()) {
+        // an event cut off by the process going away, show what we got of it
+        QStringList rest;
+        for (auto& item : m_eventParser.flush()) {
+            rest.append(std::get<QString>(item));
+        }
+        emit logLines(rest, MessageLevel::StdOut);
+    }
     switch (state) {
         case LoggedProcess::FailedToStart: {
             //: Error message displayed if instace can't start
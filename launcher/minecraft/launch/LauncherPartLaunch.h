@@ -17,6 +17,7 @@
 
 #include <LoggedProcess.h>
 #include <launch/LaunchStep.h>
+#include <launch/Log4jEventParser.h>
 #include <minecraft/auth/AuthSession.h>
 
 #include "MinecraftTarget.h"
@@ -38,9 +39,11 @@ class LauncherPartLaunch : public LaunchStep {
 
    private slots:
     void on_state(LoggedProcess::State state);
+    void onProcessLog(const QStringList& lines, MessageLevel::Enum level);
 
    private:
     LoggedProcess m_process;
+    Log4jEventParser m_eventParser;
     QString m_command;
     AuthSessionPtr m_session;
     QString m_launchScript;
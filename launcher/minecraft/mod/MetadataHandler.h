@@ -54,5 +54,7 @@ class Metadata {
 
     static auto get(QDir& index_dir, QVariant& mod_id) -> ModStruct { return Packwiz::V1::getIndexForMod(index_dir, mod_id); }
 
+    static auto getAll(QDir& index_dir) -> QList<ModStruct> { return Packwiz::V1::getAllIndexes(index_dir); }
+
     static auto modSideToString(ModSide side) -> QString { return Packwiz::V1::sideToString(side); }
 };
@@ -5,6 +5,7 @@
 #include <QRegularExpression>
 #include <tuple>
 
+#include "ContentStore.h"
 #include "FileSystem.h"
 #include "StringUtils.h"
 
@@ -195,7 +196,7 @@ bool Resource::isSymLinkUnder(const QString& instPath) const
 
 bool Resource::isMoreThanOneHardLink() const
 {
-    return FS::hardLinkCount(m_file_info.absoluteFilePath()) > 1;
+    return ContentStore::linkCount(m_file_info.absoluteFilePath()) > 1;
 }
 
 auto Resource::getOriginalFileName() const -> QString
@@ -21,6 +21,7 @@
 #include <QDebug>
 #include <algorithm>
 #include <memory>
+#include "Application.h"
 #include "Json.h"
 #include "QObjectPtr.h"
 #include "minecraft/PackProfile.h"
@@ -29,6 +30,7 @@
 #include "modplatform/ResourceAPI.h"
 #include "modplatform/flame/FlameAPI.h"
 #include "modplatform/modrinth/ModrinthAPI.h"
+#include "tasks/ConcurrentTask.h"
 #include "tasks/SequentialTask.h"
 #include "ui/pages/modplatform/ModModel.h"
 #include "ui/pages/modplatform/flame/FlameResourceModels.h"
@@ -78,9 +80,70 @@ void GetModDependenciesTask::prepare()
     for (auto sel : m_selected) {
         if (checkDependencies(sel, m_version, m_loaderType))
             for (auto dep : getDependenciesForVersion(sel->version, sel->pack->provider)) {
-                addTask(prepareDependencyTask(dep, sel->pack->provider, 20));
+                queueDependency(dep, sel->pack->provider, 20);
             }
     }
+    if (auto task = prepareNextLevel())
+        addTask(task);
+}
+
+void GetModDependenciesTask::queueDependency(const ModPlatform::Dependency& dep,
+                                             const ModPlatform::ResourceProvider providerName,
+                                             int level)
+{
+    auto key = QString("%1:%2").arg(ModPlatform::ProviderCapabilities::name(providerName),
+                                    dep.addonId.toString().isEmpty() ? "version/" + dep.version : dep.addonId.toString());
+    if (m_queued.contains(key))
+        return;
+    m_queued.insert(key);
+    m_pending.append({ dep, providerName, level });
+}
+
+// resolves the versions of all the queued dependencies at once, and the versions they depend on as the next level once they are done
+Task::Ptr GetModDependenciesTask::prepareNextLevel()
+{
+    if (m_pending.isEmpty())
+        return nullptr;
+    auto pending = m_pending;
+    m_pending.clear();
+
+    auto versions =
+        makeShared<ConcurrentTask>(this, "DependencyVersions", APPLICATION->settings()->get("NumberOfConcurrentTasks").toInt());
+    QList<std::shared_ptr<PackDependency>> level;
+    for (const auto& queued : pending) {
+        auto pDep = std::make_shared<PackDependency>();
+        pDep->dependency = queued.dependency;
+        pDep->pack = std::make_shared<ModPlatform::IndexedPack>();
+        pDep->pack->addonId = queued.dependency.addonId;
+        pDep->pack->provider = queued.provider;
+        m_pack_dependencies.append(pDep);
+
+        if (auto task = prepareDependencyTask(pDep, queued.level)) {
+            versions->addTask(task);
+            level.append(pDep);
+        } else {
+            m_pack_dependencies.removeOne(pDep);
+        }
+    }
+
+    connect(versions.get(), &Task::succeeded, this, [this, level] {
+        // the projects of this level are looked up while the next level is resolved
+        auto next = makeShared<ConcurrentTask>(this, "DependencyInfo", 3);
+        bool hasTasks = false;
+        for (const auto& provider : { m_flame_provider, m_modrinth_provider }) {
+            if (auto info = getProjectsInfoTask(provider, level)) {
+                next->addTask(info);
+                hasTasks = true;
+            }
+        }
+        if (auto task = prepareNextLevel()) {
+            next->addTask(task);
+            hasTasks = true;
+        }
+        if (hasTasks)
+            addTask(next);
+    });
+    return versions;
 }
 
 ModPlatform::Dependency GetModDependenciesTask::getOverride(const ModPlatform::Dependency& dep,
@@ -132,7 +195,7 @@ QList<ModPlatform::Dependency> GetModDependenciesTask::getDependenciesForVersion
 
         if (auto dep = std::find_if(m_pack_dependencies.begin(), m_pack_dependencies.end(),
                                     [&ver_dep, providerName, isOnlyVersion](std::shared_ptr<PackDependency> i) {
-                                        return i->pack->provider == providerName && (isOnlyVersion ? i->version.version == ver_dep.addonId
+                                        return i->pack->provider == providerName && (isOnlyVersion ? i->version.version == ver_dep.version
                                                                                                    : i->pack->addonId == ver_dep.addonId);
                                     });
             dep != m_pack_dependencies.end())  // check loaded dependencies
@@ -143,53 +206,63 @@ QList<ModPlatform::Dependency> GetModDependenciesTask::getDependenciesForVersion
     return c_dependencies;
 }
 
-Task::Ptr GetModDependenciesTask::getProjectInfoTask(std::shared_ptr<PackDependency> pDep)
+Task::Ptr GetModDependenciesTask::getProjectsInfoTask(const Provider& provider, const QList<std::shared_ptr<PackDependency>>& deps)
 {
-    auto provider = pDep->pack->provider == m_flame_provider.name ? m_flame_provider : m_modrinth_provider;
+    QHash<QString, std::shared_ptr<PackDependency>> byId;
+    for (const auto& pDep : deps) {
+        auto addonId = pDep->pack->addonId.toString();
+        // skip what got dropped while resolving the versions
+        if (pDep->pack->provider == provider.name && !addonId.isEmpty() && m_pack_dependencies.contains(pDep))
+            byId.insert(addonId, pDep);
+    }
+    if (byId.isEmpty())
+        return nullptr;
+
     auto responseInfo = std::make_shared<QByteArray>();
-    auto info = provider.api->getProject(pDep->pack->addonId.toString(), responseInfo);
-    QObject::connect(info.get(), &NetJob::succeeded, [this, responseInfo, provider, pDep] {
+    auto info = provider.api->getProjects(byId.keys(), responseInfo);
+    QObject::connect(info.get(), &NetJob::succeeded, [this, responseInfo, provider, byId]() mutable {
         QJsonParseError parse_error{};
         QJsonDocument doc = QJsonDocument::fromJson(*responseInfo, &parse_error);
         if (parse_error.error != QJsonParseError::NoError) {
-            removePack(pDep->pack->addonId);
+            for (const auto& pDep : byId)
+                removePack(pDep->pack->addonId);
             qWarning() << "Error while parsing JSON response for mod info at " << parse_error.offset
                        << " reason: " << parse_error.errorString();
             qDebug() << *responseInfo;
             return;
         }
         try {
-            auto obj = provider.name == ModPlatform::ResourceProvider::FLAME ? Json::requireObject(Json::requireObject(doc), "data")
-                                                                             : Json::requireObject(doc);
-            provider.mod->loadIndexedPack(*pDep->pack, obj);
+            auto isFlame = provider.name == ModPlatform::ResourceProvider::FLAME;
+            auto entries = isFlame ? Json::requireArray(Json::requireObject(doc), "data") : Json::requireArray(doc);
+            for (auto entry : entries) {
+                auto obj = Json::requireObject(entry);
+                auto id = isFlame ? QString::number(Json::requireInteger(obj, "id")) : Json::requireString(obj, "id");
+                auto pDep = byId.take(id);
+                if (!pDep)
+                    continue;
+                try {
+                    provider.mod->loadIndexedPack(*pDep->pack, obj);
+                } catch (const JSONValidationError& e) {
+                    removePack(pDep->pack->addonId);
+                    qWarning() << "Error while reading mod info: " << e.cause();
+                }
+            }
         } catch (const JSONValidationError& e) {
-            removePack(pDep->pack->addonId);
             qDebug() << doc;
             qWarning() << "Error while reading mod info: " << e.cause();
         }
+        for (const auto& pDep : byId) {
+            removePack(pDep->pack->addonId);
+            qWarning() << "No mod info for" << pDep->pack->addonId;
+        }
     });
     return info;
 }
 
-Task::Ptr GetModDependenciesTask::prepareDependencyTask(const ModPlatform::Dependency& dep,
-                                                        const ModPlatform::ResourceProvider providerName,
-                                                        int level)
+Task::Ptr GetModDependenciesTask::prepareDependencyTask(std::shared_ptr<PackDependency> pDep, int level)
 {
-    auto pDep = std::make_shared<PackDependency>();
-    pDep->dependency = dep;
-    pDep->pack = std::make_shared<ModPlatform::IndexedPack>();
-    pDep->pack->addonId = dep.addonId;
-    pDep->pack->provider = providerName;
-
-    m_pack_dependencies.append(pDep);
-    auto provider = providerName == m_flame_provider.name ? m_flame_provider : m_modrinth_provider;
-
-    auto tasks = makeShared<SequentialTask>(
-        this, QString("DependencyInfo: %1").arg(dep.addonId.toString().isEmpty() ? dep.version : dep.addonId.toString()));
-
-    if (!dep.addonId.toString().isEmpty()) {
-        tasks->addTask(getProjectInfoTask(pDep));
-    }
+    auto dep = pDep->dependency;
+    auto provider = pDep->pack->provider == m_flame_provider.name ? m_flame_provider : m_modrinth_provider;
 
     ResourceAPI::DependencySearchArgs args = { dep, m_version, m_loaderType };
     ResourceAPI::DependencySearchCallbacks callbacks;
@@ -212,7 +285,7 @@ Task::Ptr GetModDependenciesTask::prepareDependencyTask(const ModPlatform::Depen
                                              [dep, provider](auto o) { return o.provider == provider.name && dep.addonId == o.quilt; });
                     if (over != overide.cend()) {
                         removePack(dep.addonId);
-                        addTask(prepareDependencyTask({ over->fabric, dep.type }, provider.name, level));
+                        queueDependency({ over->fabric, dep.type }, provider.name, level);
                         return;
                     }
                 }
@@ -241,9 +314,8 @@ Task::Ptr GetModDependenciesTask::prepareDependencyTask(const ModPlatform::Depen
             auto dep_ = getOverride({ pDep->version.addonId, pDep->dependency.type }, provider.name);
             if (dep_.addonId != pDep->version.addonId) {
                 removePack(pDep->version.addonId);
-                addTask(prepareDependencyTask(dep_, provider.name, level));
-            } else {
-                addTask(getProjectInfoTask(pDep));
+                queueDependency(dep_, provider.name, level);
+                return;
             }
         }
         if (isLocalyInstalled(pDep)) {
@@ -251,13 +323,11 @@ Task::Ptr GetModDependenciesTask::prepareDependencyTask(const ModPlatform::Depen
             return;
         }
         for (auto dep_ : getDependenciesForVersion(pDep->version, provider.name)) {
-            addTask(prepareDependencyTask(dep_, provider.name, level - 1));
+            queueDependency(dep_, provider.name, level - 1);
         }
     };
 
-    auto version = provider.api->getDependencyVersion(std::move(args), std::move(callbacks));
-    tasks->addTask(version);
-    return tasks;
+    return provider.api->getDependencyVersion(std::move(args), std::move(callbacks));
 }
 
 void GetModDependenciesTask::removePack(const QVariant& addonId)
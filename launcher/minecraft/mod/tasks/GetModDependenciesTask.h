@@ -21,6 +21,7 @@
 #include <QDir>
 #include <QEventLoop>
 #include <QList>
+#include <QSet>
 #include <QVariant>
 #include <functional>
 #include <memory>
@@ -70,11 +71,13 @@ class GetModDependenciesTask : public SequentialTask {
     QHash<QString, PackDependencyExtraInfo> getExtraInfo();
 
    protected slots:
-    Task::Ptr prepareDependencyTask(const ModPlatform::Dependency&, ModPlatform::ResourceProvider, int);
+    void queueDependency(const ModPlatform::Dependency&, ModPlatform::ResourceProvider, int);
+    Task::Ptr prepareNextLevel();
+    Task::Ptr prepareDependencyTask(std::shared_ptr<PackDependency> pDep, int);
     QList<ModPlatform::Dependency> getDependenciesForVersion(const ModPlatform::IndexedVersion&,
                                                              ModPlatform::ResourceProvider providerName);
     void prepare();
-    Task::Ptr getProjectInfoTask(std::shared_ptr<PackDependency> pDep);
+    Task::Ptr getProjectsInfoTask(const Provider& provider, const QList<std::shared_ptr<PackDependency>>& deps);
     ModPlatform::Dependency getOverride(const ModPlatform::Dependency&, ModPlatform::ResourceProvider providerName);
     void removePack(const QVariant& addonId);
 
@@ -82,7 +85,17 @@ class GetModDependenciesTask : public SequentialTask {
     bool maybeInstalled(std::shared_ptr<PackDependency> pDep);
 
    private:
+    struct PendingDependency {
+        ModPlatform::Dependency dependency;
+        ModPlatform::ResourceProvider provider;
+        int level;
+    };
+
     QList<std::shared_ptr<PackDependency>> m_pack_dependencies;
+    // dependencies found while resolving a level, they are resolved together as the next one
+    QList<PendingDependency> m_pending;
+    // every dependency queued so far, so each is only resolved once however many mods require it
+    QSet<QString> m_queued;
     QList<std::shared_ptr<Metadata::ModStruct>> m_mods;
     QList<std::shared_ptr<PackDependency>> m_selected;
     QStringList m_mods_file_names;
@@ -128,14 +128,7 @@ void ModFolderLoadTask::executeTask()
 
 void ModFolderLoadTask::getFromMetadata()
 {
-    m_index_dir.refresh();
-    for (auto entry : m_index_dir.entryList(QDir::Files)) {
-        auto metadata = Metadata::get(m_index_dir, entry);
-
-        if (!metadata.isValid()) {
-            continue;
-        }
-
+    for (auto& metadata : Metadata::getAll(m_index_dir)) {
         auto* mod = new Mod(m_mods_dir, metadata);
         mod->setStatus(ModStatus::NotInstalled);
         m_result->mods[mod->internal_id()].reset(std::move(mod));
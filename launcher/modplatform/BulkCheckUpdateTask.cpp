@@ -0,0 +1,388 @@
+#include "BulkCheckUpdateTask.h"
+
+#include <QDebug>
+#include <QDir>
+#include <QFileInfo>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QtConcurrentMap>
+
+#include "Exception.h"
+#include "FileSystem.h"
+#include "Json.h"
+
+#include "minecraft/MinecraftInstance.h"
+#include "minecraft/PackProfile.h"
+
+#include "modplatform/flame/FlameAPI.h"
+#include "modplatform/flame/FlameModIndex.h"
+#include "modplatform/modrinth/ModrinthAPI.h"
+#include "modplatform/modrinth/ModrinthPackIndex.h"
+
+static ModrinthAPI modrinth_api;
+static FlameAPI flame_api;
+
+// how many hashes or ids are sent to a provider at once
+static const int s_batch_size = 100;
+
+static const auto s_loader_flags = { ModPlatform::ModLoaderType::NeoForge, ModPlatform::ModLoaderType::Forge,
+                                     ModPlatform::ModLoaderType::Quilt, ModPlatform::ModLoaderType::Fabric };
+
+static QString modrinthHashType()
+{
+    return ModPlatform::ProviderCapabilities::hashType(ModPlatform::ResourceProvider::MODRINTH).first();
+}
+
+static QList<QStringList> chunked(const QStringList& list)
+{
+    QList<QStringList> chunks;
+    for (int i = 0; i < list.size(); i += s_batch_size)
+        chunks.append(list.mid(i, s_batch_size));
+    return chunks;
+}
+
+BulkCheckUpdateTask::BulkCheckUpdateTask(QList<InstancePtr> instances) : Task(nullptr), m_instances(std::move(instances)) {}
+
+bool BulkCheckUpdateTask::abort()
+{
+    m_collecting.cancel();
+    bool aborted = true;
+    for (auto task : QList<Task::Ptr>(m_requests)) {
+        task->disconnect(this);
+        aborted &= task->abort();
+    }
+    m_requests.clear();
+    emitAborted();
+    return aborted;
+}
+
+void BulkCheckUpdateTask::executeTask()
+{
+    setStatus(tr("Reading the mods of %n instance(s)...", "", m_instances.size()));
+
+    m_hash_cache = std::make_shared<Hashing::HashCache>(QDir("cache").absoluteFilePath("hashes.json"));
+
+    // the pack profiles are not thread-safe, loaded ones are asked here and the others are read from their file in the background
+    for (auto& instance : m_instances) {
+        auto minecraft = std::dynamic_pointer_cast<MinecraftInstance>(instance);
+        if (!minecraft)
+            continue;
+        Target target{ static_cast<int>(m_results.size()), minecraft->modsRoot(), {}, {}, m_hash_cache };
+        auto profile = minecraft->getPackProfile();
+        target.bucket.mcVersion = profile->getComponentVersion("net.minecraft");
+        if (target.bucket.mcVersion.isEmpty()) {
+            target.packFile = FS::PathCombine(minecraft->instanceRoot(), "mmc-pack.json");
+        } else {
+            for (auto loader : profile->getModLoadersList())
+                target.bucket.loaders |= loader;
+        }
+        m_targets.append(target);
+        m_results.append({ instance->id(), instance->name(), {}, {} });
+    }
+
+    connect(&m_collecting, &QFutureWatcher<Collected>::finished, this, &BulkCheckUpdateTask::collected);
+    m_collecting.setFuture(QtConcurrent::mapped(m_targets, &BulkCheckUpdateTask::collect));
+}
+
+BulkCheckUpdateTask::Bucket BulkCheckUpdateTask::readPackFile(const QString& packFile)
+{
+    Bucket bucket;
+    QStringList enabled;
+    try {
+        auto components = Json::ensureArray(Json::requireObject(Json::requireDocument(packFile, packFile)), "components");
+        for (auto component : components) {
+            auto component_obj = component.toObject();
+            if (component_obj.value("disabled").toBool())
+                continue;
+            auto uid = component_obj.value("uid").toString();
+            if (uid == "net.minecraft")
+                bucket.mcVersion = component_obj.value("version").toString();
+            enabled.append(uid);
+        }
+    } catch (const Exception& e) {
+        qWarning() << "Unable to read the components of" << packFile << ":" << e.cause();
+        return {};
+    }
+    for (auto loader : PackProfile::modLoadersOf(enabled, bucket.mcVersion))
+        bucket.loaders |= loader;
+    return bucket;
+}
+
+BulkCheckUpdateTask::Collected BulkCheckUpdateTask::collect(const Target& target)
+{
+    Collected collected;
+    collected.info = target.packFile.isEmpty() ? target.bucket : readPackFile(target.packFile);
+    if (collected.info.mcVersion.isEmpty() || !collected.info.loaders)
+        return collected;
+    collected.bucket = QString("%1/%2").arg(collected.info.mcVersion).arg(static_cast<int>(collected.info.loaders));
+
+    QDir index_dir(FS::PathCombine(target.modsDir, ".index"));
+    if (!index_dir.exists())
+        return collected;
+
+    auto hash_type = modrinthHashType();
+    for (auto& mod : Metadata::getAll(index_dir)) {
+        if (!mod.isValid())
+            continue;
+        Entry entry{ target.result, collected.bucket, mod, {} };
+        if (mod.provider == ModPlatform::ResourceProvider::MODRINTH) {
+            if (mod.hash_format == hash_type) {
+                entry.hash = mod.hash;
+            } else {
+                auto path = FS::PathCombine(target.modsDir, mod.filename);
+                if (!QFileInfo::exists(path))
+                    path += ".disabled";
+                entry.hash = target.hashCache->hash(path, Hashing::algorithmFromString(hash_type));
+            }
+            if (entry.hash.isEmpty())
+                continue;
+        } else if (mod.provider != ModPlatform::ResourceProvider::FLAME) {
+            continue;
+        }
+        collected.entries.append(entry);
+    }
+    return collected;
+}
+
+void BulkCheckUpdateTask::collected()
+{
+    if (m_collecting.isCanceled())
+        return;
+    m_hash_cache->save();
+
+    // vanilla instances are left out of the results now that their mod loaders are known
+    QList<Result> results;
+    auto gathered = m_collecting.future().results();
+    for (int i = 0; i < gathered.size(); i++) {
+        if (gathered[i].bucket.isEmpty())
+            continue;
+        m_buckets.insert(gathered[i].bucket, gathered[i].info);
+        for (auto entry : gathered[i].entries) {
+            entry.result = results.size();
+            m_entries.append(entry);
+        }
+        results.append(m_results[m_targets[i].result]);
+    }
+    m_results = results;
+
+    // the same jar is usually installed in many instances, but only needs to be asked about once per bucket
+    QHash<QString, QSet<QString>> modrinth_hashes;
+    for (auto& entry : m_entries) {
+        if (entry.mod.provider == ModPlatform::ResourceProvider::MODRINTH)
+            modrinth_hashes[entry.bucket].insert(entry.hash);
+        else
+            m_flame_projects[entry.mod.project_id.toString()].insert(entry.bucket);
+    }
+
+    setStatus(tr("Checking %n mod(s) for updates...", "", m_entries.size()));
+
+    for (auto it = modrinth_hashes.constBegin(); it != modrinth_hashes.constEnd(); it++) {
+        for (auto& hashes : chunked(QStringList(it->begin(), it->end())))
+            checkModrinth(it.key(), hashes);
+    }
+    for (auto& ids : chunked(m_flame_projects.keys()))
+        checkFlameProjects(ids);
+
+    checkFinished();
+}
+
+void BulkCheckUpdateTask::checkModrinth(const QString& bucket, const QStringList& hashes)
+{
+    auto& info = m_buckets[bucket];
+    auto response = std::make_shared<QByteArray>();
+    auto job =
+        modrinth_api.latestVersions(hashes, modrinthHashType(), std::list<Version>{ Version(info.mcVersion) }, info.loaders, response);
+
+    connect(job.get(), &Task::succeeded, this, [this, bucket, hashes, response] {
+        QJsonParseError parse_error{};
+        QJsonDocument doc = QJsonDocument::fromJson(*response, &parse_error);
+        if (parse_error.error != QJsonParseError::NoError) {
+            qWarning() << "Error while parsing JSON response from Modrinth at" << parse_error.offset
+                       << "reason:" << parse_error.errorString();
+            m_errors.append(parse_error.errorString());
+            return;
+        }
+
+        // Sometimes a version may have multiple files, one with "forge" and one with "fabric",
+        // so we may want to filter it
+        QString loader_filter;
+        for (auto flag : s_loader_flags) {
+            if (m_buckets[bucket].loaders.testFlag(flag)) {
+                loader_filter = ModPlatform::getModLoaderAsString(flag);
+                break;
+            }
+        }
+
+        auto obj = doc.object();
+        for (auto& hash : hashes) {
+            m_modrinth_checked.insert({ bucket, hash });
+            auto version_obj = obj.value(hash).toObject();
+            if (version_obj.isEmpty())
+                continue;
+            try {
+                auto version = Modrinth::loadIndexedPackVersion(version_obj, modrinthHashType(), loader_filter);
+                m_modrinth_latest.insert({ bucket, hash }, version);
+            } catch (Json::JsonException& e) {
+                qWarning() << "Failed to parse the latest Modrinth version for" << hash << ":" << e.cause();
+            }
+        }
+    });
+
+    startRequest(job);
+}
+
+void BulkCheckUpdateTask::checkFlameProjects(const QStringList& projectIds)
+{
+    auto response = std::make_shared<QByteArray>();
+    // the cached answer could be missing files released since
+    auto job = flame_api.getProjects(projectIds, response, false);
+
+    connect(job.get(), &Task::succeeded, this, [this, response] {
+        QJsonParseError parse_error{};
+        QJsonDocument doc = QJsonDocument::fromJson(*response, &parse_error);
+        if (parse_error.error != QJsonParseError::NoError) {
+            qWarning() << "Error while parsing JSON response from CurseForge at" << parse_error.offset
+                       << "reason:" << parse_error.errorString();
+            m_errors.append(parse_error.errorString());
+            return;
+        }
+
+        // latestFilesIndexes holds the newest file of a project for every game version, mod loader and release type,
+        // which is all we need to know whether there is an update
+        QSet<QString> files;
+        for (auto project : doc.object().value("data").toArray()) {
+            auto project_obj = project.toObject();
+            auto project_id = QString::number(project_obj.value("id").toInt());
+            m_flame_checked.insert(project_id);
+
+            auto indexes = project_obj.value("latestFilesIndexes").toArray();
+            for (auto& bucket : m_flame_projects.value(project_id)) {
+                auto& info = m_buckets[bucket];
+                QMap<int, int> latest;
+                for (auto index : indexes) {
+                    auto index_obj = index.toObject();
+                    if (index_obj.value("gameVersion").toString() != info.mcVersion)
+                        continue;
+                    auto mod_loader = index_obj.value("modLoader");
+                    if (!mod_loader.isNull() && !mod_loader.isUndefined()) {
+                        bool matches = false;
+                        for (auto flag : s_loader_flags)
+                            matches |= info.loaders.testFlag(flag) && FlameAPI::getMappedModLoader(flag) == mod_loader.toInt();
+                        if (!matches)
+                            continue;
+                    }
+                    auto& newest = latest[index_obj.value("releaseType").toInt()];
+                    newest = std::max(newest, index_obj.value("fileId").toInt());
+                }
+                if (latest.isEmpty())
+                    continue;
+                m_flame_latest.insert({ project_id, bucket }, latest);
+                for (auto file_id : latest)
+                    files.insert(QString::number(file_id));
+            }
+        }
+
+        for (auto& ids : chunked(QStringList(files.begin(), files.end())))
+            checkFlameFiles(ids);
+    });
+
+    startRequest(job);
+}
+
+void BulkCheckUpdateTask::checkFlameFiles(const QStringList& fileIds)
+{
+    auto response = std::make_shared<QByteArray>();
+    auto job = flame_api.getFiles(fileIds, response, false);
+
+    connect(job.get(), &Task::succeeded, this, [this, response] {
+        QJsonParseError parse_error{};
+        QJsonDocument doc = QJsonDocument::fromJson(*response, &parse_error);
+        if (parse_error.error != QJsonParseError::NoError) {
+            qWarning() << "Error while parsing JSON response from CurseForge at" << parse_error.offset
+                       << "reason:" << parse_error.errorString();
+            m_errors.append(parse_error.errorString());
+            return;
+        }
+
+        for (auto file : doc.object().value("data").toArray()) {
+            auto file_obj = file.toObject();
+            try {
+                auto version = FlameMod::loadIndexedPackVersion(file_obj);
+                m_flame_files.insert(version.fileId.toString(), version);
+            } catch (Json::JsonException& e) {
+                qWarning() << "Failed to parse a CurseForge file:" << e.cause();
+            }
+        }
+    });
+
+    startRequest(job);
+}
+
+void BulkCheckUpdateTask::startRequest(Task::Ptr task)
+{
+    connect(task.get(), &Task::failed, this, [this](const QString& reason) { m_errors.append(reason); });
+    connect(task.get(), &Task::finished, this, [this, task] {
+        m_requests.removeOne(task);
+        checkFinished();
+    });
+
+    m_requests.append(task);
+    task->start();
+}
+
+void BulkCheckUpdateTask::checkFinished()
+{
+    if (!isRunning() || !m_requests.isEmpty())
+        return;
+
+    int checked = 0;
+    for (auto& entry : m_entries) {
+        auto& result = m_results[entry.result];
+        auto& mod = entry.mod;
+
+        if (mod.provider == ModPlatform::ResourceProvider::MODRINTH) {
+            // the request for this mod failed, so we know nothing about it
+            if (!m_modrinth_checked.contains({ entry.bucket, entry.hash }))
+                continue;
+            checked++;
+
+            auto version = m_modrinth_latest.find({ entry.bucket, entry.hash });
+            if (version == m_modrinth_latest.end()) {
+                result.unavailable.append(mod.name);
+                continue;
+            }
+            if (version->hash != entry.hash && version->is_preferred)
+                result.updates.append({ mod.name, mod.filename, mod.provider, version->version_number, version->fileName });
+        } else {
+            auto project_id = mod.project_id.toString();
+            if (!m_flame_checked.contains(project_id))
+                continue;
+            checked++;
+
+            auto latest = m_flame_latest.find({ project_id, entry.bucket });
+            if (latest == m_flame_latest.end()) {
+                result.unavailable.append(mod.name);
+                continue;
+            }
+            // files are only offered if they are as stable as the installed one, release types go from 1 (release) to 3 (alpha)
+            auto release_type = mod.releaseType.isValid() ? static_cast<int>(mod.releaseType.m_type) : 1;
+            int newest = 0;
+            for (auto it = latest->constBegin(); it != latest->constEnd() && it.key() <= release_type; it++)
+                newest = std::max(newest, it.value());
+            // file ids only ever grow, a smaller one is older than the installed file
+            auto version = m_flame_files.find(QString::number(newest));
+            if (newest > mod.file_id.toInt() && version != m_flame_files.end())
+                result.updates.append({ mod.name, mod.filename, mod.provider, version->version, version->fileName });
+        }
+    }
+
+    if (!m_errors.isEmpty()) {
+        qWarning() << "Some mod update checks failed:" << m_errors;
+        if (checked == 0) {
+            emitFailed(m_errors.first());
+            return;
+        }
+    }
+    emitSucceeded();
+}
@@ -0,0 +1,119 @@
+#pragma once
+
+#include "BaseInstance.h"
+#include "ModIndex.h"
+
+#include "minecraft/mod/MetadataHandler.h"
+#include "modplatform/helpers/HashUtils.h"
+
+#include "tasks/Task.h"
+
+#include <QFutureWatcher>
+#include <QMap>
+#include <QSet>
+
+/**
+ * Looks for mod updates in many instances at once.
+ *
+ * The metadata of every instance is read in the background, and the mods are grouped by Minecraft version and mod loaders,
+ * so each provider is asked once per group for all the mods in it, no matter how many instances share them.
+ * Jars without a usable hash in their metadata are hashed through a persistent index, so only changed files are read again.
+ *
+ * This only reports the outdated mods, updating them is left to the instances themselves.
+ */
+class BulkCheckUpdateTask : public Task {
+    Q_OBJECT
+
+   public:
+    struct Update {
+        QString name;
+        QString fileName;
+        ModPlatform::ResourceProvider provider;
+        QString newVersion;
+        QString newFileName;
+    };
+
+    struct Result {
+        QString instanceId;
+        QString instanceName;
+        QList<Update> updates;
+        // names of the mods no compatible version could be found for
+        QStringList unavailable;
+    };
+
+    explicit BulkCheckUpdateTask(QList<InstancePtr> instances);
+    ~BulkCheckUpdateTask() override = default;
+
+    /** One result per checked instance, in the order they were given. Vanilla instances are left out. */
+    const QList<Result>& results() const { return m_results; }
+
+   public slots:
+    bool abort() override;
+
+   protected slots:
+    void executeTask() override;
+
+   private:
+    struct Bucket {
+        QString mcVersion;
+        ModPlatform::ModLoaderTypes loaders;
+    };
+
+    struct Target {
+        int result;
+        QString modsDir;
+        // read in the background when the profile of the instance was not loaded yet
+        QString packFile;
+        Bucket bucket;
+        std::shared_ptr<Hashing::HashCache> hashCache;
+    };
+
+    struct Entry {
+        int result;
+        QString bucket;
+        Metadata::ModStruct mod;
+        // Modrinth only, the hash of the jar as the API expects it
+        QString hash;
+    };
+
+    struct Collected {
+        // empty for instances without a mod loader
+        QString bucket;
+        Bucket info;
+        QList<Entry> entries;
+    };
+
+    static Bucket readPackFile(const QString& packFile);
+    static Collected collect(const Target& target);
+
+    void collected();
+    void checkModrinth(const QString& bucket, const QStringList& hashes);
+    void checkFlameProjects(const QStringList& projectIds);
+    void checkFlameFiles(const QStringList& fileIds);
+    void startRequest(Task::Ptr task);
+    void checkFinished();
+
+   private:
+    QList<InstancePtr> m_instances;
+    QList<Result> m_results;
+    QList<Target> m_targets;
+    QHash<QString, Bucket> m_buckets;
+
+    std::shared_ptr<Hashing::HashCache> m_hash_cache;
+    QFutureWatcher<Collected> m_collecting;
+    QList<Entry> m_entries;
+
+    // the latest Modrinth version of every (bucket, hash) pair
+    QHash<QPair<QString, QString>, ModPlatform::IndexedVersion> m_modrinth_latest;
+    QSet<QPair<QString, QString>> m_modrinth_checked;
+    // the buckets each Flame project is needed in
+    QHash<QString, QSet<QString>> m_flame_projects;
+    // the newest Flame file id of every (project, bucket) pair, by release type
+    QHash<QPair<QString, QString>, QMap<int, int>> m_flame_latest;
+    QHash<QString, ModPlatform::IndexedVersion> m_flame_files;
+    QSet<QString> m_flame_checked;
+
+    // requests in flight
+    QList<Task::Ptr> m_requests;
+    QStringList m_errors;
+};
@@ -2,6 +2,7 @@
 
 #include <MurmurHash2.h>
 #include <QDebug>
+#include <QtConcurrentMap>
 
 #include "Application.h"
 #include "Json.h"
@@ -18,42 +19,41 @@
 static ModrinthAPI modrinth_api;
 static FlameAPI flame_api;
 
+// how many hashes are sent to the provider at once
+// smaller batches start sooner, so more of the network time overlaps with the hashing
+static const int s_batch_size = 50;
+
+static Hashing::Algorithm hashAlgorithm(ModPlatform::ResourceProvider provider)
+{
+    if (provider == ModPlatform::ResourceProvider::FLAME)
+        return Hashing::Algorithm::Murmur2;
+    return Hashing::algorithmFromString(ModPlatform::ProviderCapabilities::hashType(provider).first());
+}
+
+static QString hashFile(const QPair<QString, Hashing::Algorithm>& file)
+{
+    return Hashing::hash(file.first, file.second);
+}
+
 EnsureMetadataTask::EnsureMetadataTask(Mod* mod, QDir dir, ModPlatform::ResourceProvider prov)
-    : Task(nullptr), m_index_dir(dir), m_provider(prov), m_hashing_task(nullptr), m_current_task(nullptr)
+    : Task(nullptr), m_index_dir(dir), m_provider(prov)
 {
-    auto hash_task = createNewHash(mod);
-    if (!hash_task)
-        return;
-    connect(hash_task.get(), &Hashing::Hasher::resultsReady, [this, mod](QString hash) { m_mods.insert(hash, mod); });
-    connect(hash_task.get(), &Task::failed, [this, mod] { emitFail(mod, "", RemoveFromList::No); });
-    hash_task->start();
+    if (mod)
+        m_to_hash.append(mod);
 }
 
 EnsureMetadataTask::EnsureMetadataTask(QList<Mod*>& mods, QDir dir, ModPlatform::ResourceProvider prov)
-    : Task(nullptr), m_index_dir(dir), m_provider(prov), m_current_task(nullptr)
+    : Task(nullptr), m_index_dir(dir), m_provider(prov)
 {
-    m_hashing_task.reset(new ConcurrentTask(this, "MakeHashesTask", APPLICATION->settings()->get("NumberOfConcurrentTasks").toInt()));
     for (auto* mod : mods) {
-        auto hash_task = createNewHash(mod);
-        if (!hash_task)
-            continue;
-        connect(hash_task.get(), &Hashing::Hasher::resultsReady, [this, mod](QString hash) { m_mods.insert(hash, mod); });
-        connect(hash_task.get(), &Task::failed, [this, mod] { emitFail(mod, "", RemoveFromList::No); });
-        m_hashing_task->addTask(hash_task);
+        if (mod)
+            m_to_hash.append(mod);
     }
 }
 EnsureMetadataTask::EnsureMetadataTask(QHash<QString, Mod*>& mods, QDir dir, ModPlatform::ResourceProvider prov)
-    : Task(nullptr), m_mods(mods), m_index_dir(dir), m_provider(prov), m_current_task(nullptr)
+    : Task(nullptr), m_mods(mods), m_index_dir(dir), m_provider(prov)
 {}
 
-Hashing::Hasher::Ptr EnsureMetadataTask::createNewHash(Mod* mod)
-{
-    if (!mod || !mod->valid() || mod->type() == ResourceType::FOLDER)
-        return nullptr;
-
-    return Hashing::createHasher(mod->fileinfo().absoluteFilePath(), m_provider);
-}
-
 QString EnsureMetadataTask::getExistingHash(Mod* mod)
 {
     // Check for already computed hashes
@@ -79,97 +79,186 @@ bool EnsureMetadataTask::abort()
     // Prevent sending signals to a dead object
     disconnect(this, 0, 0, 0);
 
-    if (m_current_task)
-        return m_current_task->abort();
-    return true;
+    m_hashing.cancel();
+    bool aborted = true;
+    for (auto task : QList<Task::Ptr>(m_requests)) {
+        // don't let an aborted request start the next step of its batch
+        task->disconnect(this);
+        aborted &= task->abort();
+    }
+    emitAborted();
+    return aborted;
 }
 
 void EnsureMetadataTask::executeTask()
 {
     setStatus(tr("Checking if mods have metadata..."));
 
-    for (auto* mod : m_mods) {
+    // settles the mods that don't need to be looked up, before spending any time on hashing them
+    auto needsLookup = [this](Mod* mod, const QString& key, RemoveFromList remove) {
         if (!mod->valid()) {
             qDebug() << "Mod" << mod->name() << "is invalid!";
-            emitFail(mod);
-            continue;
+            emitFail(mod, key, remove);
+            return false;
         }
 
         // They already have the right metadata :o
         if (mod->status() != ModStatus::NoMetadata && mod->metadata() && mod->metadata()->provider == m_provider) {
             qDebug() << "Mod" << mod->name() << "already has metadata!";
-            emitReady(mod);
-            continue;
+            emitReady(mod, key, remove);
+            return false;
         }
 
         // Folders don't have metadata
         if (mod->type() == ResourceType::FOLDER) {
-            emitReady(mod);
+            emitReady(mod, key, remove);
+            return false;
         }
+        return true;
+    };
+
+    for (auto& hash : m_mods.keys()) {
+        if (needsLookup(m_mods.value(hash), hash, RemoveFromList::Yes))
+            m_batch.append(hash);
+    }
+
+    QList<Mod*> to_hash;
+    QList<QPair<QString, Hashing::Algorithm>> files;
+    for (auto* mod : m_to_hash) {
+        if (!needsLookup(mod, {}, RemoveFromList::No))
+            continue;
+        to_hash.append(mod);
+        files.append({ mod->fileinfo().absoluteFilePath(), hashAlgorithm(m_provider) });
+    }
+    m_to_hash = to_hash;
+
+    auto count = m_batch.size() + m_to_hash.size();
+    if (count > 1)
+        setStatus(tr("Requesting metadata information from %1...").arg(ModPlatform::ProviderCapabilities::readableName(m_provider)));
+    else if (!m_batch.empty())
+        setStatus(tr("Requesting metadata information from %1 for '%2'...")
+                      .arg(ModPlatform::ProviderCapabilities::readableName(m_provider), m_mods.value(m_batch.first())->name()));
+    else if (!m_to_hash.empty())
+        setStatus(tr("Requesting metadata information from %1 for '%2'...")
+                      .arg(ModPlatform::ProviderCapabilities::readableName(m_provider), m_to_hash.first()->name()));
+
+    if (m_to_hash.isEmpty()) {
+        hashingFinished();
+        return;
     }
 
+    setProgress(0, m_to_hash.size());
+    connect(&m_hashing, &QFutureWatcher<QString>::resultReadyAt, this, &EnsureMetadataTask::hashReady);
+    connect(&m_hashing, &QFutureWatcher<QString>::finished, this, &EnsureMetadataTask::hashingFinished);
+    m_hashing.setFuture(QtConcurrent::mapped(files, hashFile));
+}
+
+void EnsureMetadataTask::hashReady(int index)
+{
+    setProgress(getProgress() + 1, m_to_hash.size());
+
+    auto* mod = m_to_hash.at(index);
+    auto hash = m_hashing.resultAt(index);
+    if (hash.isEmpty()) {
+        qWarning() << "Could not hash" << mod->name();
+        emitFail(mod, {}, RemoveFromList::No);
+        return;
+    }
+
+    if (!m_mods.contains(hash))
+        m_batch.append(hash);
+    m_mods.insert(hash, mod);
+
+    if (m_batch.size() >= s_batch_size)
+        requestBatch();
+}
+
+void EnsureMetadataTask::hashingFinished()
+{
+    if (m_hashing.isCanceled())
+        return;
+    m_hashing_done = true;
+    requestBatch();
+    checkFinished();
+}
+
+void EnsureMetadataTask::requestBatch()
+{
+    if (m_batch.isEmpty())
+        return;
+    auto hashes = m_batch;
+    m_batch.clear();
+
     Task::Ptr version_task;
 
     switch (m_provider) {
         case (ModPlatform::ResourceProvider::MODRINTH):
-            version_task = modrinthVersionsTask();
+            version_task = modrinthVersionsTask(hashes);
             break;
         case (ModPlatform::ResourceProvider::FLAME):
-            version_task = flameVersionsTask();
+            version_task = flameVersionsTask(hashes);
             break;
     }
 
-    auto invalidade_leftover = [this] {
-        for (auto mod = m_mods.constBegin(); mod != m_mods.constEnd(); mod++)
-            emitFail(mod.value(), mod.key(), RemoveFromList::No);
-        m_mods.clear();
+    if (!version_task) {
+        finishBatch(hashes);
+        return;
+    }
 
-        emitSucceeded();
-    };
+    connect(version_task.get(), &Task::finished, this, [this, hashes, version_task] {
+        m_requests.removeOne(version_task);
 
-    connect(version_task.get(), &Task::finished, this, [this, invalidade_leftover] {
         Task::Ptr project_task;
 
         switch (m_provider) {
             case (ModPlatform::ResourceProvider::MODRINTH):
-                project_task = modrinthProjectsTask();
+                project_task = modrinthProjectsTask(hashes);
                 break;
             case (ModPlatform::ResourceProvider::FLAME):
-                project_task = flameProjectsTask();
+                project_task = flameProjectsTask(hashes);
                 break;
         }
 
         if (!project_task) {
-            invalidade_leftover();
+            finishBatch(hashes);
             return;
         }
 
-        connect(project_task.get(), &Task::finished, this, [=] {
-            invalidade_leftover();
-            project_task->deleteLater();
-            if (m_current_task)
-                m_current_task.reset();
+        connect(project_task.get(), &Task::finished, this, [this, hashes, project_task] {
+            m_requests.removeOne(project_task);
+            finishBatch(hashes);
         });
         connect(project_task.get(), &Task::failed, this, &EnsureMetadataTask::emitFailed);
 
-        m_current_task = project_task;
+        m_requests.append(project_task);
         project_task->start();
     });
 
-    connect(version_task.get(), &Task::finished, [=] {
-        version_task->deleteLater();
-        if (m_current_task)
-            m_current_task.reset();
-    });
+    m_requests.append(version_task);
+    version_task->start();
+}
 
-    if (m_mods.size() > 1)
-        setStatus(tr("Requesting metadata information from %1...").arg(ModPlatform::ProviderCapabilities::readableName(m_provider)));
-    else if (!m_mods.empty())
-        setStatus(tr("Requesting metadata information from %1 for '%2'...")
-                      .arg(ModPlatform::ProviderCapabilities::readableName(m_provider), m_mods.begin().value()->name()));
+void EnsureMetadataTask::finishBatch(const QStringList& hashes)
+{
+    // whatever is left of the batch could not be found
+    for (auto& hash : hashes) {
+        m_temp_versions.remove(hash);
+        if (auto mod = m_mods.find(hash); mod != m_mods.end())
+            emitFail(mod.value(), hash);
+    }
+    checkFinished();
+}
 
-    m_current_task = version_task;
-    version_task->start();
+void EnsureMetadataTask::checkFinished()
+{
+    if (!isRunning() || !m_hashing_done || !m_requests.isEmpty() || !m_batch.isEmpty())
+        return;
+
+    for (auto mod = m_mods.constBegin(); mod != m_mods.constEnd(); mod++)
+        emitFail(mod.value(), mod.key(), RemoveFromList::No);
+    m_mods.clear();
+
+    emitSucceeded();
 }
 
 void EnsureMetadataTask::emitReady(Mod* m, QString key, RemoveFromList remove)
@@ -214,18 +303,18 @@ void EnsureMetadataTask::emitFail(Mod* m, QString key, RemoveFromList remove)
 
 // Modrinth
 
-Task::Ptr EnsureMetadataTask::modrinthVersionsTask()
+Task::Ptr EnsureMetadataTask::modrinthVersionsTask(const QStringList& hashes)
 {
     auto hash_type = ModPlatform::ProviderCapabilities::hashType(ModPlatform::ResourceProvider::MODRINTH).first();
 
     auto response = std::make_shared<QByteArray>();
-    auto ver_task = modrinth_api.currentVersions(m_mods.keys(), hash_type, response);
+    auto ver_task = modrinth_api.currentVersions(hashes, hash_type, response);
 
     // Prevents unfortunate timings when aborting the task
     if (!ver_task)
         return Task::Ptr{ nullptr };
 
-    connect(ver_task.get(), &Task::succeeded, this, [this, response] {
+    connect(ver_task.get(), &Task::succeeded, this, [this, response, hashes] {
         QJsonParseError parse_error{};
         QJsonDocument doc = QJsonDocument::fromJson(*response, &parse_error);
         if (parse_error.error != QJsonParseError::NoError) {
@@ -239,7 +328,9 @@ Task::Ptr EnsureMetadataTask::modrinthVersionsTask()
 
         try {
             auto entries = Json::requireObject(doc);
-            for (auto& hash : m_mods.keys()) {
+            for (auto& hash : hashes) {
+                if (!m_mods.contains(hash))
+                    continue;
                 auto mod = m_mods.find(hash).value();
                 try {
                     auto entry = Json::requireObject(entries, hash);
@@ -264,11 +355,13 @@ Task::Ptr EnsureMetadataTask::modrinthVersionsTask()
     return ver_task;
 }
 
-Task::Ptr EnsureMetadataTask::modrinthProjectsTask()
+Task::Ptr EnsureMetadataTask::modrinthProjectsTask(const QStringList& hashes)
 {
     QHash<QString, QString> addonIds;
-    for (auto const& data : m_temp_versions)
-        addonIds.insert(data.addonId.toString(), data.hash);
+    for (auto const& hash : hashes) {
+        if (m_temp_versions.contains(hash))
+            addonIds.insert(m_temp_versions.value(hash).addonId.toString(), hash);
+    }
 
     auto response = std::make_shared<QByteArray>();
     Task::Ptr proj_task;
@@ -349,12 +442,12 @@ Task::Ptr EnsureMetadataTask::modrinthProjectsTask()
 }
 
 // Flame
-Task::Ptr EnsureMetadataTask::flameVersionsTask()
+Task::Ptr EnsureMetadataTask::flameVersionsTask(const QStringList& hashes)
 {
     auto response = std::make_shared<QByteArray>();
 
     QList<uint> fingerprints;
-    for (auto& murmur : m_mods.keys()) {
+    for (auto& murmur : hashes) {
         fingerprints.push_back(murmur.toUInt());
     }
 
@@ -414,10 +507,10 @@ Task::Ptr EnsureMetadataTask::flameVersionsTask()
     return ver_task;
 }
 
-Task::Ptr EnsureMetadataTask::flameProjectsTask()
+Task::Ptr EnsureMetadataTask::flameProjectsTask(const QStringList& hashes)
 {
     QHash<QString, QString> addonIds;
-    for (auto const& hash : m_mods.keys()) {
+    for (auto const& hash : hashes) {
         if (m_temp_versions.contains(hash)) {
             auto data = m_temp_versions.find(hash).value();
 
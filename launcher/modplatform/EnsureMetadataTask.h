@@ -4,12 +4,19 @@
 
 #include "modplatform/helpers/HashUtils.h"
 
-#include "tasks/ConcurrentTask.h"
+#include "tasks/Task.h"
 
 #include <QDir>
+#include <QFutureWatcher>
 
 class Mod;
 
+/**
+ * Makes sure the given mods have metadata from the given provider.
+ *
+ * The mods are hashed in the background, and the hashes are sent to the provider in batches as they come in,
+ * so the requests overlap with the hashing of the remaining mods.
+ */
 class EnsureMetadataTask : public Task {
     Q_OBJECT
 
@@ -20,8 +27,6 @@ class EnsureMetadataTask : public Task {
 
     ~EnsureMetadataTask() = default;
 
-    Task::Ptr getHashingTask() { return m_hashing_task; }
-
    public slots:
     bool abort() override;
    protected slots:
@@ -29,11 +34,18 @@ class EnsureMetadataTask : public Task {
 
    private:
     // FIXME: Move to their own namespace
-    auto modrinthVersionsTask() -> Task::Ptr;
-    auto modrinthProjectsTask() -> Task::Ptr;
+    auto modrinthVersionsTask(const QStringList& hashes) -> Task::Ptr;
+    auto modrinthProjectsTask(const QStringList& hashes) -> Task::Ptr;
+
+    auto flameVersionsTask(const QStringList& hashes) -> Task::Ptr;
+    auto flameProjectsTask(const QStringList& hashes) -> Task::Ptr;
 
-    auto flameVersionsTask() -> Task::Ptr;
-    auto flameProjectsTask() -> Task::Ptr;
+    // Pipeline
+    void hashReady(int index);
+    void hashingFinished();
+    void requestBatch();
+    void finishBatch(const QStringList& hashes);
+    void checkFinished();
 
     // Helpers
     enum class RemoveFromList { Yes, No };
@@ -41,7 +53,6 @@ class EnsureMetadataTask : public Task {
     void emitFail(Mod*, QString key = {}, RemoveFromList = RemoveFromList::Yes);
 
     // Hashes and stuff
-    auto createNewHash(Mod*) -> Hashing::Hasher::Ptr;
     auto getExistingHash(Mod*) -> QString;
 
    private slots:
@@ -58,6 +69,13 @@ class EnsureMetadataTask : public Task {
     ModPlatform::ResourceProvider m_provider;
 
     QHash<QString, ModPlatform::IndexedVersion> m_temp_versions;
-    ConcurrentTask::Ptr m_hashing_task;
-    Task::Ptr m_current_task;
+
+    // mods still to be hashed, in the order of the hashing results
+    QList<Mod*> m_to_hash;
+    QFutureWatcher<QString> m_hashing;
+    bool m_hashing_done = false;
+    // hashes that have not been sent to the provider yet
+    QStringList m_batch;
+    // requests in flight
+    QList<Task::Ptr> m_requests;
 };
@@ -65,6 +65,31 @@ namespace ATLauncher {
 
 static Meta::Version::Ptr getComponentVersion(const QString& uid, const QString& version);
 
+// LiteLoader libraries by md5, they are installed as the matching component instead
+static const QMap<QString, QString> liteLoaderMap = {
+    { "61179803bcd5fb7790789b790908663d", "1.12-SNAPSHOT" },   { "1420785ecbfed5aff4a586c5c9dd97eb", "1.12.2-SNAPSHOT" },
+    { "073f68e2fcb518b91fd0d99462441714", "1.6.2_03" },        { "10a15b52fc59b1bfb9c05b56de1097d6", "1.6.2_02" },
+    { "b52f90f08303edd3d4c374e268a5acf1", "1.6.2_04" },        { "ea747e24e03e24b7cad5bc8a246e0319", "1.6.2_01" },
+    { "55785ccc82c07ff0ba038fe24be63ea2", "1.7.10_01" },       { "63ada46e033d0cb6782bada09ad5ca4e", "1.7.10_04" },
+    { "7983e4b28217c9ae8569074388409c86", "1.7.10_03" },       { "c09882458d74fe0697c7681b8993097e", "1.7.10_02" },
+    { "db7235aefd407ac1fde09a7baba50839", "1.7.10_00" },       { "6e9028816027f53957bd8fcdfabae064", "1.8" },
+    { "5e732dc446f9fe2abe5f9decaec40cde", "1.10-SNAPSHOT" },   { "3a98b5ed95810bf164e71c1a53be568d", "1.11.2-SNAPSHOT" },
+    { "ba8e6285966d7d988a96496f48cbddaa", "1.8.9-SNAPSHOT" },  { "8524af3ac3325a82444cc75ae6e9112f", "1.11-SNAPSHOT" },
+    { "53639d52340479ccf206a04f5e16606f", "1.5.2_01" },        { "1fcdcf66ce0a0806b7ad8686afdce3f7", "1.6.4_00" },
+    { "531c116f71ae2b11033f9a11a0f8e668", "1.6.4_01" },        { "4009eeb99c9068f608d3483a6439af88", "1.7.2_03" },
+    { "66f343354b8417abce1a10d557d2c6e9", "1.7.2_04" },        { "ab554c21f28fbc4ae9b098bcb5f4cceb", "1.7.2_05" },
+    { "e1d76a05a3723920e2f80a5e66c45f16", "1.7.2_02" },        { "00318cb0c787934d523f63cdfe8ddde4", "1.9-SNAPSHOT" },
+    { "986fd1ee9525cb0dcab7609401cef754", "1.9.4-SNAPSHOT" },  { "571ad5e6edd5ff40259570c9be588bb5", "1.9.4" },
+    { "1cdd72f7232e45551f16cc8ffd27ccf3", "1.10.2-SNAPSHOT" }, { "8a7c21f32d77ee08b393dd3921ced8eb", "1.10.2" },
+    { "b9bef8abc8dc309069aeba6fbbe58980", "1.12.1-SNAPSHOT" }
+};
+
+static const QMap<QString, QString> loaderUids = {
+    { "forge", "net.minecraftforge" },
+    { "neoforge", "net.neoforged" },
+    { "fabric", "net.fabricmc.fabric-loader" },
+};
+
 PackInstallTask::PackInstallTask(UserInteractionSupport* support, QString packName, QString version, InstallMode installMode)
 {
     m_support = support;
@@ -76,6 +101,9 @@ PackInstallTask::PackInstallTask(UserInteractionSupport* support, QString packNa
 
 bool PackInstallTask::abort()
 {
+    if (m_metaTask) {
+        return m_metaTask->abort();
+    }
     if (abortable) {
         return jobPtr->abort();
     }
@@ -147,6 +175,35 @@ void PackInstallTask::onDownloadSucceeded()
     if (!message.isEmpty())
         m_support->displayMessage(message);
 
+    // load everything the install looks up in the metadata index at once
+    QList<std::pair<QString, QString>> metaVersions{ { "net.minecraft", m_version.minecraft } };
+    for (const auto& lib : m_version.libraries) {
+        if (liteLoaderMap.contains(lib.md5))
+            metaVersions.append({ "com.mumfrey.liteloader", liteLoaderMap.value(lib.md5) });
+    }
+    for (const auto& mod : m_version.mods) {
+        if (mod.type == ModType::Forge)
+            metaVersions.append({ "net.minecraftforge", mod.version });
+    }
+    if ((m_version.loader.recommended || m_version.loader.latest || m_version.loader.choose) && loaderUids.contains(m_version.loader.type))
+        metaVersions.append({ loaderUids.value(m_version.loader.type), QString() });
+
+    setStatus(tr("Loading metadata"));
+    m_metaTask = APPLICATION->metadataIndex()->loadVersions(metaVersions);
+    // a failed load is reported below, by whatever ends up missing
+    connect(m_metaTask.get(), &Task::succeeded, this, [this, resetDirectory] { onMetadataLoaded(resetDirectory); });
+    connect(m_metaTask.get(), &Task::failed, this, [this, resetDirectory] { onMetadataLoaded(resetDirectory); });
+    connect(m_metaTask.get(), &Task::aborted, this, [this] {
+        m_metaTask.reset();
+        emitAborted();
+    });
+    m_metaTask->start();
+}
+
+void PackInstallTask::onMetadataLoaded(bool resetDirectory)
+{
+    m_metaTask.reset();
+
     auto ver = getComponentVersion("net.minecraft", m_version.minecraft);
     if (!ver) {
         emitFailed(tr("Failed to get local metadata index for '%1' v%2").arg("net.minecraft", m_version.minecraft));
@@ -343,7 +400,10 @@ QString PackInstallTask::getVersionForLoader(QString uid)
             return Q_NULLPTR;
         }
 
-        vlist->waitToLoad();
+        if (!vlist->isLoaded()) {
+            emitFailed(tr("Failed to load the version list of %1").arg(uid));
+            return Q_NULLPTR;
+        }
 
         if (m_version.loader.recommended || m_version.loader.latest) {
             for (int i = 0; i < vlist->versions().size(); i++) {
@@ -460,24 +520,6 @@ bool PackInstallTask::createLibrariesComponent(QString instanceRoot, std::shared
     auto f = std::make_shared<VersionFile>();
     f->name = m_pack_name + " " + m_version_name + " (libraries)";
 
-    const static QMap<QString, QString> liteLoaderMap = {
-        { "61179803bcd5fb7790789b790908663d", "1.12-SNAPSHOT" },   { "1420785ecbfed5aff4a586c5c9dd97eb", "1.12.2-SNAPSHOT" },
-        { "073f68e2fcb518b91fd0d99462441714", "1.6.2_03" },        { "10a15b52fc59b1bfb9c05b56de1097d6", "1.6.2_02" },
-        { "b52f90f08303edd3d4c374e268a5acf1", "1.6.2_04" },        { "ea747e24e03e24b7cad5bc8a246e0319", "1.6.2_01" },
-        { "55785ccc82c07ff0ba038fe24be63ea2", "1.7.10_01" },       { "63ada46e033d0cb6782bada09ad5ca4e", "1.7.10_04" },
-        { "7983e4b28217c9ae8569074388409c86", "1.7.10_03" },       { "c09882458d74fe0697c7681b8993097e", "1.7.10_02" },
-        { "db7235aefd407ac1fde09a7baba50839", "1.7.10_00" },       { "6e9028816027f53957bd8fcdfabae064", "1.8" },
-        { "5e732dc446f9fe2abe5f9decaec40cde", "1.10-SNAPSHOT" },   { "3a98b5ed95810bf164e71c1a53be568d", "1.11.2-SNAPSHOT" },
-        { "ba8e6285966d7d988a96496f48cbddaa", "1.8.9-SNAPSHOT" },  { "8524af3ac3325a82444cc75ae6e9112f", "1.11-SNAPSHOT" },
-        { "53639d52340479ccf206a04f5e16606f", "1.5.2_01" },        { "1fcdcf66ce0a0806b7ad8686afdce3f7", "1.6.4_00" },
-        { "531c116f71ae2b11033f9a11a0f8e668", "1.6.4_01" },        { "4009eeb99c9068f608d3483a6439af88", "1.7.2_03" },
-        { "66f343354b8417abce1a10d557d2c6e9", "1.7.2_04" },        { "ab554c21f28fbc4ae9b098bcb5f4cceb", "1.7.2_05" },
-        { "e1d76a05a3723920e2f80a5e66c45f16", "1.7.2_02" },        { "00318cb0c787934d523f63cdfe8ddde4", "1.9-SNAPSHOT" },
-        { "986fd1ee9525cb0dcab7609401cef754", "1.9.4-SNAPSHOT" },  { "571ad5e6edd5ff40259570c9be588bb5", "1.9.4" },
-        { "1cdd72f7232e45551f16cc8ffd27ccf3", "1.10.2-SNAPSHOT" }, { "8a7c21f32d77ee08b393dd3921ced8eb", "1.10.2" },
-        { "b9bef8abc8dc309069aeba6fbbe58980", "1.12.1-SNAPSHOT" }
-    };
-
     for (const auto& lib : m_version.libraries) {
         // If the library is LiteLoader, we need to ignore it and handle it separately.
         if (liteLoaderMap.contains(lib.md5)) {
@@ -1069,7 +1111,9 @@ void PackInstallTask::install()
 
 static Meta::Version::Ptr getComponentVersion(const QString& uid, const QString& version)
 {
-    return APPLICATION->metadataIndex()->getLoadedVersion(uid, version);
+    // the versions are loaded upfront by onDownloadSucceeded()
+    auto ver = APPLICATION->metadataIndex()->get(uid, version);
+    return ver->isLoaded() ? ver : nullptr;
 }
 
 }  // namespace ATLauncher
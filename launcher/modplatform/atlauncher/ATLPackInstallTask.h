@@ -98,6 +98,7 @@ class PackInstallTask : public InstanceTask {
     void onDownloadSucceeded();
     void onDownloadFailed(QString reason);
     void onDownloadAborted();
+    void onMetadataLoaded(bool resetDirectory);
 
     void onModsDownloaded();
     void onModsExtracted();
@@ -125,6 +126,7 @@ class PackInstallTask : public InstanceTask {
     bool abortable = false;
 
     NetJob::Ptr jobPtr;
+    Task::Ptr m_metaTask;
     std::shared_ptr<QByteArray> response = std::make_shared<QByteArray>();
 
     InstallMode m_install_mode;
@@ -154,6 +154,11 @@ QList<ModPlatform::IndexedVersion> FlameAPI::getLatestVersions(VersionSearchArgs
 }
 
 Task::Ptr FlameAPI::getProjects(QStringList addonIds, std::shared_ptr<QByteArray> response) const
+{
+    return getProjects(addonIds, response, true);
+}
+
+Task::Ptr FlameAPI::getProjects(QStringList addonIds, std::shared_ptr<QByteArray> response, bool useCache) const
 {
     auto netJob = makeShared<NetJob>(QString("Flame::GetProjects"), APPLICATION->network());
 
@@ -168,14 +173,16 @@ Task::Ptr FlameAPI::getProjects(QStringList addonIds, std::shared_ptr<QByteArray
     QJsonDocument body(body_obj);
     auto body_raw = body.toJson();
 
-    netJob->addNetAction(Net::ApiUpload::makeByteArray(QString("https://api.curseforge.com/v1/mods"), response, body_raw));
+    QUrl url("https://api.curseforge.com/v1/mods");
+    netJob->addNetAction(useCache ? Net::ApiUpload::makeCachedByteArray(url, response, body_raw, PROJECT_CACHE_TTL)
+                                  : Net::ApiUpload::makeByteArray(url, response, body_raw));
 
     QObject::connect(netJob.get(), &NetJob::failed, [body_raw] { qDebug() << body_raw; });
 
     return netJob;
 }
 
-Task::Ptr FlameAPI::getFiles(const QStringList& fileIds, std::shared_ptr<QByteArray> response) const
+Task::Ptr FlameAPI::getFiles(const QStringList& fileIds, std::shared_ptr<QByteArray> response, bool useCache) const
 {
     auto netJob = makeShared<NetJob>(QString("Flame::GetFiles"), APPLICATION->network());
 
@@ -190,7 +197,9 @@ Task::Ptr FlameAPI::getFiles(const QStringList& fileIds, std::shared_ptr<QByteAr
     QJsonDocument body(body_obj);
     auto body_raw = body.toJson();
 
-    netJob->addNetAction(Net::ApiUpload::makeByteArray(QString("https://api.curseforge.com/v1/mods/files"), response, body_raw));
+    QUrl url("https://api.curseforge.com/v1/mods/files");
+    netJob->addNetAction(useCache ? Net::ApiUpload::makeCachedByteArray(url, response, body_raw, PROJECT_CACHE_TTL)
+                                  : Net::ApiUpload::makeByteArray(url, response, body_raw));
 
     QObject::connect(netJob.get(), &NetJob::failed, [body_raw] { qDebug() << body_raw; });
 
@@ -21,8 +21,10 @@ class FlameAPI : public NetworkResourceAPI {
                                                                 ModPlatform::ModLoaderTypes fallback);
 
     Task::Ptr getProjects(QStringList addonIds, std::shared_ptr<QByteArray> response) const override;
+    /// update checks pass useCache = false, a cached answer could hide files released since
+    Task::Ptr getProjects(QStringList addonIds, std::shared_ptr<QByteArray> response, bool useCache) const;
     Task::Ptr matchFingerprints(const QList<uint>& fingerprints, std::shared_ptr<QByteArray> response);
-    Task::Ptr getFiles(const QStringList& fileIds, std::shared_ptr<QByteArray> response) const;
+    Task::Ptr getFiles(const QStringList& fileIds, std::shared_ptr<QByteArray> response, bool useCache = true) const;
     Task::Ptr getFile(const QString& addonId, const QString& fileId, std::shared_ptr<QByteArray> response) const;
 
     static Task::Ptr getCategories(std::shared_ptr<QByteArray> response, ModPlatform::ResourceType type);
@@ -36,22 +38,6 @@ class FlameAPI : public NetworkResourceAPI {
         return loaders & (ModPlatform::NeoForge | ModPlatform::Forge | ModPlatform::Fabric | ModPlatform::Quilt);
     }
 
-   private:
-    static int getClassId(ModPlatform::ResourceType type)
-    {
-        switch (type) {
-            default:
-            case ModPlatform::ResourceType::MOD:
-                return 6;
-            case ModPlatform::ResourceType::RESOURCE_PACK:
-                return 12;
-            case ModPlatform::ResourceType::SHADER_PACK:
-                return 6552;
-            case ModPlatform::ResourceType::MODPACK:
-                return 4471;
-        }
-    }
-
     static int getMappedModLoader(ModPlatform::ModLoaderType loaders)
     {
         // https://docs.curseforge.com/?http#tocS_ModLoaderType
@@ -72,6 +58,22 @@ class FlameAPI : public NetworkResourceAPI {
         return 0;
     }
 
+   private:
+    static int getClassId(ModPlatform::ResourceType type)
+    {
+        switch (type) {
+            default:
+            case ModPlatform::ResourceType::MOD:
+                return 6;
+            case ModPlatform::ResourceType::RESOURCE_PACK:
+                return 12;
+            case ModPlatform::ResourceType::SHADER_PACK:
+                return 6552;
+            case ModPlatform::ResourceType::MODPACK:
+                return 4471;
+        }
+    }
+
     static const QStringList getModLoaderStrings(const ModPlatform::ModLoaderTypes types)
     {
         QStringList l;
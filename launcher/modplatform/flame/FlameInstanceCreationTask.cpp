@@ -552,7 +552,13 @@ void FlameCreationTask::setupDownloadJob(QEventLoop& loop)
 
         if (!result.version.downloadUrl.isEmpty()) {
             qDebug() << "Will download" << result.version.downloadUrl << "to" << path;
-            auto dl = Net::ApiDownload::makeFile(result.version.downloadUrl, path);
+            Net::Download::Ptr dl;
+            if (result.version.hash_type == "sha1" && !result.version.hash.isEmpty()) {
+                auto hash = QByteArray::fromHex(result.version.hash.toLatin1());
+                dl = Net::ApiDownload::makeStored(result.version.downloadUrl, path, QCryptographicHash::Sha1, hash);
+            } else {
+                dl = Net::ApiDownload::makeFile(result.version.downloadUrl, path);
+            }
             m_files_job->addNetAction(dl);
         }
     }
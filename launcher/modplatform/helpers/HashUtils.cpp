@@ -1,8 +1,15 @@
 #include "HashUtils.h"
 
 #include <QBuffer>
+#include <QDateTime>
 #include <QDebug>
+#include <QDir>
 #include <QFile>
+#include <QFileInfo>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QSaveFile>
 #include <QtConcurrentRun>
 
 #include <MurmurHash2.h>
@@ -135,6 +142,89 @@ QString hash(QByteArray data, Algorithm type)
     return hash(&buff, type);
 }
 
+static QString hashCacheKey(const QString& fileName, Algorithm type)
+{
+    return algorithmToString(type) + ':' + fileName;
+}
+
+HashCache::HashCache(QString cacheFile) : m_cacheFile(std::move(cacheFile))
+{
+    QFile file(m_cacheFile);
+    if (!file.open(QFile::ReadOnly))
+        return;
+
+    auto doc = QJsonDocument::fromJson(file.readAll());
+    for (auto value : doc.object().value("entries").toArray()) {
+        auto obj = value.toObject();
+        auto type = algorithmFromString(obj.value("algorithm").toString());
+        auto path = obj.value("path").toString();
+        if (type == Algorithm::Unknown || path.isEmpty())
+            continue;
+        m_entries.insert(hashCacheKey(path, type), { obj.value("size").toVariant().toLongLong(),
+                                                     obj.value("modified").toVariant().toLongLong(), obj.value("hash").toString() });
+    }
+}
+
+QString HashCache::hash(const QString& fileName, Algorithm type)
+{
+    QFileInfo info(fileName);
+    if (!info.isFile())
+        return {};
+    auto path = info.absoluteFilePath();
+    auto key = hashCacheKey(path, type);
+    auto size = info.size();
+    auto modified = info.lastModified().toMSecsSinceEpoch();
+
+    {
+        QMutexLocker lock(&m_mutex);
+        auto it = m_entries.constFind(key);
+        if (it != m_entries.constEnd() && it->size == size && it->modified == modified)
+            return it->hash;
+    }
+
+    auto result = Hashing::hash(path, type);
+    if (result.isEmpty())
+        return result;
+
+    QMutexLocker lock(&m_mutex);
+    m_entries.insert(key, { size, modified, result });
+    m_dirty = true;
+    return result;
+}
+
+void HashCache::save()
+{
+    QMutexLocker lock(&m_mutex);
+    if (!m_dirty)
+        return;
+
+    QJsonArray entries;
+    for (auto it = m_entries.begin(); it != m_entries.end();) {
+        auto separator = it.key().indexOf(':');
+        auto path = it.key().mid(separator + 1);
+        if (!QFileInfo::exists(path)) {
+            it = m_entries.erase(it);
+            continue;
+        }
+        entries.append(QJsonObject{ { "path", path },
+                                    { "algorithm", it.key().left(separator) },
+                                    { "size", it->size },
+                                    { "modified", it->modified },
+                                    { "hash", it->hash } });
+        ++it;
+    }
+
+    QDir().mkpath(QFileInfo(m_cacheFile).absolutePath());
+    QSaveFile file(m_cacheFile);
+    if (!file.open(QFile::WriteOnly)) {
+        qWarning() << "[Hashing] Failed to save hash cache to" << m_cacheFile;
+        return;
+    }
+    file.write(QJsonDocument(QJsonObject{ { "formatVersion", 1 }, { "entries", entries } }).toJson(QJsonDocument::Compact));
+    if (file.commit())
+        m_dirty = false;
+}
+
 void Hasher::executeTask()
 {
     m_future = QtConcurrent::run(
@@ -3,6 +3,8 @@
 #include <QCryptographicHash>
 #include <QFuture>
 #include <QFutureWatcher>
+#include <QHash>
+#include <QMutex>
 #include <QString>
 
 #include "modplatform/ModIndex.h"
@@ -45,6 +47,34 @@ class Hasher : public Task {
     QFutureWatcher<QString> m_watcher;
 };
 
+/**
+ * Persistent index of file hashes, keyed by path and algorithm.
+ *
+ * A cached hash is reused as long as the size and modification time of the file still match, so only changed
+ * files get rehashed. Lookups are thread-safe.
+ */
+class HashCache {
+   public:
+    explicit HashCache(QString cacheFile);
+
+    QString hash(const QString& fileName, Algorithm type);
+
+    /** Writes the index back to disk, dropping entries whose files no longer exist. */
+    void save();
+
+   private:
+    struct Entry {
+        qint64 size;
+        qint64 modified;
+        QString hash;
+    };
+
+    QString m_cacheFile;
+    QMutex m_mutex;
+    QHash<QString, Entry> m_entries;
+    bool m_dirty = false;
+};
+
 Hasher::Ptr createHasher(QString file_path, ModPlatform::ResourceProvider provider);
 Hasher::Ptr createHasher(QString file_path, QString type);
 
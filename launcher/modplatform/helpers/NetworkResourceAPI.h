@@ -18,6 +18,12 @@ class NetworkResourceAPI : public ResourceAPI {
     Task::Ptr getDependencyVersion(DependencySearchArgs&&, DependencySearchCallbacks&&) const override;
 
    protected:
+    // How long, in seconds, responses are answered from the API response cache before being revalidated.
+    // Search results and version lists change the most, and are requested again on every page or sorting change.
+    static constexpr qint64 SEARCH_CACHE_TTL = 5 * 60;
+    static constexpr qint64 VERSIONS_CACHE_TTL = 5 * 60;
+    static constexpr qint64 PROJECT_CACHE_TTL = 15 * 60;
+
     [[nodiscard]] virtual auto getSearchURL(SearchArgs const& args) const -> std::optional<QString> = 0;
     [[nodiscard]] virtual auto getInfoURL(QString const& id) const -> std::optional<QString> = 0;
     [[nodiscard]] virtual auto getVersionsURL(VersionSearchArgs const& args) const -> std::optional<QString> = 0;
@@ -14,7 +14,6 @@
 #include "modplatform/helpers/OverrideUtils.h"
 
 #include "modplatform/modrinth/ModrinthPackManifest.h"
-#include "net/ChecksumValidator.h"
 
 #include "net/ApiDownload.h"
 #include "net/NetJob.h"
@@ -263,22 +262,11 @@ bool ModrinthCreationTask::createInstance()
         }
 
         qDebug() << "Will try to download" << file.downloads.front() << "to" << file_path;
-        auto dl = Net::ApiDownload::makeFile(file.downloads.dequeue(), file_path);
-        dl->addValidator(new Net::ChecksumValidator(file.hashAlgorithm, file.hash));
+        auto dl = Net::ApiDownload::makeStored(file.downloads.dequeue(), file_path, file.hashAlgorithm, file.hash);
+        // the other urls serve the same file, and are used if the first one fails or stalls
+        for (auto& url : file.downloads)
+            dl->addMirror(url);
         downloadMods->addNetAction(dl);
-
-        if (!file.downloads.empty()) {
-            // FIXME: This really needs to be put into a ConcurrentTask of
-            // MultipleOptionsTask's , once those exist :)
-            auto param = dl.toWeakRef();
-            connect(dl.get(), &Task::failed, [&file, file_path, param, downloadMods] {
-                auto ndl = Net::ApiDownload::makeFile(file.downloads.dequeue(), file_path);
-                ndl->addValidator(new Net::ChecksumValidator(file.hashAlgorithm, file.hash));
-                downloadMods->addNetAction(ndl);
-                if (auto shared = param.lock())
-                    shared->succeeded();
-            });
-        }
     }
 
     bool ended_well = false;
@@ -22,6 +22,7 @@
 #include <QCryptographicHash>
 #include <QFileInfo>
 #include <QMessageBox>
+#include <QtConcurrentMap>
 #include <QtConcurrentRun>
 #include "Json.h"
 #include "MMCZip.h"
@@ -50,7 +51,9 @@ ModrinthPackExportTask::ModrinthPackExportTask(const QString& name,
     , gameRoot(instance->gameRoot())
     , output(output)
     , filter(filter)
-{}
+{
+    connect(&hashWatcher, &QFutureWatcher<QList<HashedFile>>::finished, this, &ModrinthPackExportTask::hashesCollected);
+}
 
 void ModrinthPackExportTask::executeTask()
 {
@@ -61,6 +64,11 @@ void ModrinthPackExportTask::executeTask()
 
 bool ModrinthPackExportTask::abort()
 {
+    if (hashFuture.isRunning()) {
+        // the remaining files are skipped, hashesCollected reports the abort
+        *hashingAborted = true;
+        return true;
+    }
     if (task) {
         task->abort();
         emitAborted();
@@ -93,9 +101,15 @@ void ModrinthPackExportTask::collectFiles()
 void ModrinthPackExportTask::collectHashes()
 {
     setStatus(tr("Finding file hashes..."));
-    for (const QFileInfo& file : files) {
-        QCoreApplication::processEvents();
 
+    QHash<QString, const Mod*> modsByPath;
+    if (mcInstance) {
+        for (const Mod* mod : mcInstance->loaderModList()->allMods())
+            modsByPath.insert(mod->fileinfo().absoluteFilePath(), mod);
+    }
+
+    QList<HashedFile> candidates;
+    for (const QFileInfo& file : files) {
         const QString relative = gameRoot.relativeFilePath(file.absoluteFilePath());
         // require sensible file types
         if (!std::any_of(PREFIXES.begin(), PREFIXES.end(), [&relative](const QString& prefix) { return relative.startsWith(prefix); }))
@@ -105,46 +119,107 @@ void ModrinthPackExportTask::collectHashes()
             }))
             continue;
 
-        QFile openFile(file.absoluteFilePath());
-        if (!openFile.open(QFile::ReadOnly)) {
-            qWarning() << "Could not open" << file << "for hashing";
-            continue;
+        HashedFile candidate;
+        candidate.relative = relative;
+        candidate.path = file.absoluteFilePath();
+
+        const Mod* mod = modsByPath.value(candidate.path);
+        if (mod != nullptr && mod->metadata() != nullptr) {
+            const auto metadata = mod->metadata();
+            if (metadata->hash_format == "sha512")
+                candidate.sha512 = metadata->hash;
+            else if (metadata->hash_format == "sha1")
+                candidate.sha1 = metadata->hash;
+
+            const QUrl& url = metadata->url;
+            // ensure the url is permitted on modrinth.com
+            if (!url.isEmpty() && BuildConfig.MODRINTH_MRPACK_HOSTS.contains(url.host())) {
+                candidate.url = url.toEncoded();
+                candidate.side = metadata->side;
+            }
         }
+        candidates.append(candidate);
+    }
+
+    setAbortable(true);
+    setProgress(0, candidates.size());
+
+    hashingAborted = std::make_shared<std::atomic_bool>(false);
+    hashFuture = QtConcurrent::run(QThreadPool::globalInstance(), [this, candidates, aborted = hashingAborted]() mutable {
+        const int total = candidates.size();
+        std::atomic_int done{ 0 };
+        QtConcurrent::blockingMap(candidates, [this, aborted, total, &done](HashedFile& file) {
+            if (*aborted)
+                return;
+            hashFile(file);
+            const int finished = ++done;
+            QMetaObject::invokeMethod(this, [this, finished, total] { setProgress(finished, total); }, Qt::QueuedConnection);
+        });
+        return candidates;
+    });
+    hashWatcher.setFuture(hashFuture);
+}
+
+void ModrinthPackExportTask::hashFile(HashedFile& file)
+{
+    QFile openFile(file.path);
+    if (!openFile.open(QFile::ReadOnly)) {
+        qWarning() << "Could not open" << file.path << "for hashing";
+        file.failed = true;
+        return;
+    }
+    file.size = openFile.size();
+
+    // the Modrinth lookup only needs sha512, sha1 is only needed for files resolved from the metadata
+    const bool needSha1 = file.sha1.isEmpty() && !file.url.isEmpty();
+    const bool needSha512 = file.sha512.isEmpty();
+    if (!needSha1 && !needSha512)
+        return;
 
-        const QByteArray data = openFile.readAll();
+    // both hashes are fed from a single pass over the file, without reading it into memory whole
+    QCryptographicHash sha1(QCryptographicHash::Sha1);
+    QCryptographicHash sha512(QCryptographicHash::Sha512);
+    while (!openFile.atEnd()) {
+        const QByteArray chunk = openFile.read(256 * 1024);
         if (openFile.error() != QFileDevice::NoError) {
-            qWarning() << "Could not read" << file;
-            continue;
-        }
-        auto sha512 = Hashing::hash(data, Hashing::Algorithm::Sha512);
-
-        auto allMods = mcInstance->loaderModList()->allMods();
-        if (auto modIter = std::find_if(allMods.begin(), allMods.end(), [&file](Mod* mod) { return mod->fileinfo() == file; });
-            modIter != allMods.end()) {
-            const Mod* mod = *modIter;
-            if (mod->metadata() != nullptr) {
-                QUrl& url = mod->metadata()->url;
-                // ensure the url is permitted on modrinth.com
-                if (!url.isEmpty() && BuildConfig.MODRINTH_MRPACK_HOSTS.contains(url.host())) {
-                    qDebug() << "Resolving" << relative << "from index";
-
-                    auto sha1 = Hashing::hash(data, Hashing::Algorithm::Sha1);
-
-                    ResolvedFile resolvedFile{ sha1, sha512, url.toEncoded(), openFile.size(), mod->metadata()->side };
-                    resolvedFiles[relative] = resolvedFile;
-
-                    // nice! we've managed to resolve based on local metadata!
-                    // no need to enqueue it
-                    continue;
-                }
-            }
+            qWarning() << "Could not read" << file.path;
+            file.failed = true;
+            return;
         }
+        if (needSha1)
+            sha1.addData(chunk);
+        if (needSha512)
+            sha512.addData(chunk);
+    }
 
-        qDebug() << "Enqueueing" << relative << "for Modrinth query";
-        pendingHashes[relative] = sha512;
+    if (needSha1)
+        file.sha1 = sha1.result().toHex();
+    if (needSha512)
+        file.sha512 = sha512.result().toHex();
+}
+
+void ModrinthPackExportTask::hashesCollected()
+{
+    if (*hashingAborted) {
+        emitAborted();
+        return;
+    }
+
+    for (const HashedFile& file : hashFuture.result()) {
+        if (file.failed)
+            continue;
+
+        if (!file.url.isEmpty()) {
+            // nice! we've managed to resolve based on local metadata!
+            // no need to enqueue it
+            qDebug() << "Resolving" << file.relative << "from index";
+            resolvedFiles[file.relative] = ResolvedFile{ file.sha1, file.sha512, file.url, file.size, file.side };
+        } else {
+            qDebug() << "Enqueueing" << file.relative << "for Modrinth query";
+            pendingHashes[file.relative] = file.sha512;
+        }
     }
 
-    setAbortable(true);
     makeApiRequest();
 }
 
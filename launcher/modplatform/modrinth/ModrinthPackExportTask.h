@@ -20,6 +20,7 @@
 
 #include <QFuture>
 #include <QFutureWatcher>
+#include <atomic>
 #include "BaseInstance.h"
 #include "MMCZip.h"
 #include "minecraft/MinecraftInstance.h"
@@ -48,6 +49,17 @@ class ModrinthPackExportTask : public Task {
         Metadata::ModSide side;
     };
 
+    struct HashedFile {
+        QString relative, path;
+        // hashes known from the mod metadata are not computed again
+        QString sha1, sha512;
+        // set when the file can be resolved from the mod metadata without asking Modrinth
+        QString url;
+        Metadata::ModSide side = Metadata::ModSide::UniversalSide;
+        qint64 size = 0;
+        bool failed = false;
+    };
+
     static const QStringList PREFIXES;
     static const QStringList FILE_EXTENSIONS;
 
@@ -65,9 +77,14 @@ class ModrinthPackExportTask : public Task {
     QMap<QString, QString> pendingHashes;
     QMap<QString, ResolvedFile> resolvedFiles;
     Task::Ptr task;
+    QFuture<QList<HashedFile>> hashFuture;
+    QFutureWatcher<QList<HashedFile>> hashWatcher;
+    std::shared_ptr<std::atomic_bool> hashingAborted;
 
     void collectFiles();
     void collectHashes();
+    void hashesCollected();
+    static void hashFile(HashedFile& file);
     void makeApiRequest();
     void parseApiResponse(std::shared_ptr<QByteArray> response);
     void buildZip();
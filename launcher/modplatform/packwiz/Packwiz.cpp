@@ -19,9 +19,14 @@
 
 #include "Packwiz.h"
 
+#include <QDateTime>
 #include <QDebug>
 #include <QDir>
+#include <QFileInfo>
+#include <QHash>
+#include <QMutex>
 #include <QObject>
+#include <QSet>
 #include <sstream>
 #include <string>
 
@@ -90,6 +95,164 @@ auto intEntry(toml::table table, QString entry_name) -> int
     return node.value_or(0);
 }
 
+static auto parseIndexFile(const QString& path) -> V1::Mod
+{
+    V1::Mod mod;
+
+    toml::table table;
+#if TOML_EXCEPTIONS
+    try {
+        table = toml::parse_file(StringUtils::toStdString(path));
+    } catch (const toml::parse_error& err) {
+        qWarning() << QString("Could not open file %1!").arg(path);
+        qWarning() << "Reason: " << QString(err.what());
+        return {};
+    }
+#else
+    toml::parse_result result = toml::parse_file(StringUtils::toStdString(path));
+    if (!result) {
+        qWarning() << QString("Could not open file %1!").arg(path);
+        qWarning() << "Reason: " << result.error().description();
+        return {};
+    }
+    table = result.table();
+#endif
+
+    mod.slug = QFileInfo(path).fileName();
+
+    {  // Basic info
+        mod.name = stringEntry(table, "name");
+        mod.filename = stringEntry(table, "filename");
+        mod.side = V1::stringToSide(stringEntry(table, "side"));
+        mod.releaseType = ModPlatform::IndexedVersionType(stringEntry(table, "x-prismlauncher-release-type"));
+        if (auto loaders = table["x-prismlauncher-loaders"]; loaders && loaders.is_array()) {
+            for (auto&& loader : *loaders.as_array()) {
+                if (loader.is_string()) {
+                    mod.loaders |= ModPlatform::getModLoaderFromString(QString::fromStdString(loader.as_string()->value_or("")));
+                }
+            }
+        }
+        if (auto versions = table["x-prismlauncher-mc-versions"]; versions && versions.is_array()) {
+            for (auto&& version : *versions.as_array()) {
+                if (version.is_string()) {
+                    auto ver = QString::fromStdString(version.as_string()->value_or(""));
+                    if (!ver.isEmpty()) {
+                        mod.mcVersions << ver;
+                    }
+                }
+            }
+            mod.mcVersions.sort();
+        }
+    }
+
+    {  // [download] info
+        auto download_table = table["download"].as_table();
+        if (!download_table) {
+            qCritical() << QString("No [download] section found on mod metadata!");
+            return {};
+        }
+
+        mod.mode = stringEntry(*download_table, "mode");
+        mod.url = stringEntry(*download_table, "url");
+        mod.hash_format = stringEntry(*download_table, "hash-format");
+        mod.hash = stringEntry(*download_table, "hash");
+    }
+
+    {  // [update] info
+        using Provider = ModPlatform::ResourceProvider;
+
+        auto update_table = table["update"];
+        if (!update_table || !update_table.is_table()) {
+            qCritical() << QString("No [update] section found on mod metadata!");
+            return {};
+        }
+
+        toml::table* mod_provider_table = nullptr;
+        if ((mod_provider_table = update_table[ModPlatform::ProviderCapabilities::name(Provider::FLAME)].as_table())) {
+            mod.provider = Provider::FLAME;
+            mod.file_id = intEntry(*mod_provider_table, "file-id");
+            mod.project_id = intEntry(*mod_provider_table, "project-id");
+        } else if ((mod_provider_table = update_table[ModPlatform::ProviderCapabilities::name(Provider::MODRINTH)].as_table())) {
+            mod.provider = Provider::MODRINTH;
+            mod.mod_id() = stringEntry(*mod_provider_table, "mod-id");
+            mod.version() = stringEntry(*mod_provider_table, "version");
+        } else {
+            qCritical() << QString("No mod provider on mod metadata!");
+            return {};
+        }
+    }
+
+    return mod;
+}
+
+// Parsed metadata files, by index directory, so finding one mod doesn't mean parsing the whole folder again.
+// Entries are checked against the file's size and modification time, so changes made outside of the launcher are picked up.
+struct IndexedFile {
+    V1::Mod mod;
+    qint64 size = 0;
+    QDateTime modified;
+};
+struct FolderIndex {
+    QHash<QString, IndexedFile> files;  // by metadata file name
+    QHash<QString, QString> ids;        // metadata file name by project id
+};
+static QMutex s_index_mutex;
+static QHash<QString, FolderIndex> s_indexes;
+
+// Must hold s_index_mutex
+static void forgetIndexFile(FolderIndex& index, const QString& file_name)
+{
+    auto file = index.files.find(file_name);
+    if (file == index.files.end())
+        return;
+    auto id = file->mod.project_id.toString();
+    if (index.ids.value(id) == file_name)
+        index.ids.remove(id);
+    index.files.erase(file);
+}
+
+// Must hold s_index_mutex
+static auto indexFile(FolderIndex& index, QDir& index_dir, const QString& file_name) -> V1::Mod
+{
+    QFileInfo info(index_dir.absoluteFilePath(file_name));
+    if (!info.isFile()) {
+        forgetIndexFile(index, file_name);
+        return {};
+    }
+
+    auto file = index.files.constFind(file_name);
+    if (file != index.files.constEnd() && file->size == info.size() && file->modified == info.lastModified())
+        return file->mod;
+
+    forgetIndexFile(index, file_name);
+    auto mod = parseIndexFile(info.absoluteFilePath());
+    index.files.insert(file_name, { mod, info.size(), info.lastModified() });
+    if (mod.isValid())
+        index.ids.insert(mod.project_id.toString(), file_name);
+    return mod;
+}
+
+// Must hold s_index_mutex
+static void scanIndexDir(FolderIndex& index, QDir& index_dir)
+{
+    index_dir.refresh();
+    auto file_names = index_dir.entryList(QDir::Filter::Files);
+    for (auto& file_name : file_names)
+        indexFile(index, index_dir, file_name);
+
+    QSet<QString> present(file_names.begin(), file_names.end());
+    for (auto& file_name : index.files.keys()) {
+        if (!present.contains(file_name))
+            forgetIndexFile(index, file_name);
+    }
+}
+
+static void forgetIndexFile(QDir& index_dir, const QString& file_name)
+{
+    QMutexLocker lock(&s_index_mutex);
+    forgetIndexFile(s_indexes[index_dir.absolutePath()], file_name);
+}
+
 auto V1::createModFormat([[maybe_unused]] QDir& index_dir,
                          ModPlatform::IndexedPack& mod_pack,
                          ModPlatform::IndexedVersion& mod_version) -> Mod
@@ -226,6 +389,9 @@ void V1::updateModIndex(QDir& index_dir, Mod& mod)
 
     index_file.flush();
     index_file.close();
+
+    forgetIndexFile(index_dir, real_fname);
+    forgetIndexFile(index_dir, normalized_fname);
 }
 
 void V1::deleteModIndex(QDir& index_dir, QString& mod_slug)
@@ -245,127 +411,72 @@ void V1::deleteModIndex(QDir& index_dir, QString& mod_slug)
     if (!index_file.remove()) {
         qWarning() << QString("Failed to remove metadata for mod %1!").arg(mod_slug);
     }
+
+    forgetIndexFile(index_dir, real_fname);
 }
 
 void V1::deleteModIndex(QDir& index_dir, QVariant& mod_id)
 {
-    for (auto& file_name : index_dir.entryList(QDir::Filter::Files)) {
-        auto mod = getIndexForMod(index_dir, file_name);
-
-        if (mod.mod_id() == mod_id) {
-            deleteModIndex(index_dir, mod.name);
-            break;
-        }
-    }
+    auto mod = getIndexForMod(index_dir, mod_id);
+    if (mod.isValid())
+        deleteModIndex(index_dir, mod.slug);
 }
 
 auto V1::getIndexForMod(QDir& index_dir, QString slug) -> Mod
 {
-    Mod mod;
-
     auto normalized_fname = indexFileName(slug);
     auto real_fname = getRealIndexName(index_dir, normalized_fname, true);
     if (real_fname.isEmpty())
         return {};
 
-    toml::table table;
-#if TOML_EXCEPTIONS
-    try {
-        table = toml::parse_file(StringUtils::toStdString(index_dir.absoluteFilePath(real_fname)));
-    } catch (const toml::parse_error& err) {
-        qWarning() << QString("Could not open file %1!").arg(normalized_fname);
-        qWarning() << "Reason: " << QString(err.what());
-        return {};
-    }
-#else
-    toml::parse_result result = toml::parse_file(StringUtils::toStdString(index_dir.absoluteFilePath(real_fname)));
-    if (!result) {
-        qWarning() << QString("Could not open file %1!").arg(normalized_fname);
-        qWarning() << "Reason: " << result.error().description();
+    QMutexLocker lock(&s_index_mutex);
+    auto mod = indexFile(s_indexes[index_dir.absolutePath()], index_dir, real_fname);
+    if (!mod.isValid())
         return {};
-    }
-    table = result.table();
-#endif
-
-    // index_file.close();
 
     mod.slug = slug;
+    return mod;
+}
 
-    {  // Basic info
-        mod.name = stringEntry(table, "name");
-        mod.filename = stringEntry(table, "filename");
-        mod.side = stringToSide(stringEntry(table, "side"));
-        mod.releaseType = ModPlatform::IndexedVersionType(stringEntry(table, "x-prismlauncher-release-type"));
-        if (auto loaders = table["x-prismlauncher-loaders"]; loaders && loaders.is_array()) {
-            for (auto&& loader : *loaders.as_array()) {
-                if (loader.is_string()) {
-                    mod.loaders |= ModPlatform::getModLoaderFromString(QString::fromStdString(loader.as_string()->value_or("")));
-                }
-            }
-        }
-        if (auto versions = table["x-prismlauncher-mc-versions"]; versions && versions.is_array()) {
-            for (auto&& version : *versions.as_array()) {
-                if (version.is_string()) {
-                    auto ver = QString::fromStdString(version.as_string()->value_or(""));
-                    if (!ver.isEmpty()) {
-                        mod.mcVersions << ver;
-                    }
-                }
-            }
-            mod.mcVersions.sort();
-        }
-    }
+auto V1::getIndexForMod(QDir& index_dir, QVariant& mod_id) -> Mod
+{
+    QMutexLocker lock(&s_index_mutex);
+    auto& index = s_indexes[index_dir.absolutePath()];
 
-    {  // [download] info
-        auto download_table = table["download"].as_table();
-        if (!download_table) {
-            qCritical() << QString("No [download] section found on mod metadata!");
+    auto find = [&]() -> Mod {
+        auto file_name = index.ids.value(mod_id.toString());
+        if (file_name.isEmpty())
             return {};
-        }
-
-        mod.mode = stringEntry(*download_table, "mode");
-        mod.url = stringEntry(*download_table, "url");
-        mod.hash_format = stringEntry(*download_table, "hash-format");
-        mod.hash = stringEntry(*download_table, "hash");
-    }
-
-    {  // [update] info
-        using Provider = ModPlatform::ResourceProvider;
-
-        auto update_table = table["update"];
-        if (!update_table || !update_table.is_table()) {
-            qCritical() << QString("No [update] section found on mod metadata!");
+        auto mod = indexFile(index, index_dir, file_name);
+        if (!mod.isValid() || mod.mod_id() != mod_id)
             return {};
-        }
+        mod.slug = file_name;
+        return mod;
+    };
 
-        toml::table* mod_provider_table = nullptr;
-        if ((mod_provider_table = update_table[ModPlatform::ProviderCapabilities::name(Provider::FLAME)].as_table())) {
-            mod.provider = Provider::FLAME;
-            mod.file_id = intEntry(*mod_provider_table, "file-id");
-            mod.project_id = intEntry(*mod_provider_table, "project-id");
-        } else if ((mod_provider_table = update_table[ModPlatform::ProviderCapabilities::name(Provider::MODRINTH)].as_table())) {
-            mod.provider = Provider::MODRINTH;
-            mod.mod_id() = stringEntry(*mod_provider_table, "mod-id");
-            mod.version() = stringEntry(*mod_provider_table, "version");
-        } else {
-            qCritical() << QString("No mod provider on mod metadata!");
-            return {};
-        }
-    }
+    if (auto mod = find(); mod.isValid())
+        return mod;
 
-    return mod;
+    // The file may have been added or changed behind our back
+    scanIndexDir(index, index_dir);
+    return find();
 }
 
-auto V1::getIndexForMod(QDir& index_dir, QVariant& mod_id) -> Mod
+auto V1::getAllIndexes(QDir& index_dir) -> QList<Mod>
 {
-    for (auto& file_name : index_dir.entryList(QDir::Filter::Files)) {
-        auto mod = getIndexForMod(index_dir, file_name);
-
-        if (mod.mod_id() == mod_id)
-            return mod;
+    QMutexLocker lock(&s_index_mutex);
+    auto& index = s_indexes[index_dir.absolutePath()];
+    scanIndexDir(index, index_dir);
+
+    QList<Mod> mods;
+    for (auto file = index.files.constBegin(); file != index.files.constEnd(); file++) {
+        if (!file->mod.isValid())
+            continue;
+        auto mod = file->mod;
+        mod.slug = file.key();
+        mods.append(mod);
     }
-
-    return {};
+    return mods;
 }
 
 auto V1::sideToString(Side side) -> QString
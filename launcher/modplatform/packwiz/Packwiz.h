@@ -98,6 +98,11 @@ class V1 {
      * */
     static auto getIndexForMod(QDir& index_dir, QVariant& mod_id) -> Mod;
 
+    /* Gets the metadata of every mod in the index directory, with their slugs set to their file names.
+     * This also brings the in-memory index of the directory up to date, so later lookups don't need to read it again.
+     * */
+    static auto getAllIndexes(QDir& index_dir) -> QList<Mod>;
+
     static auto sideToString(Side side) -> QString;
     static auto stringToSide(QString side) -> Side;
 };
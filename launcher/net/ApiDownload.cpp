@@ -36,6 +36,13 @@ Download::Ptr ApiDownload::makeByteArray(QUrl url, std::shared_ptr<QByteArray> o
     return dl;
 }
 
+Download::Ptr ApiDownload::makeCachedByteArray(QUrl url, std::shared_ptr<QByteArray> output, qint64 ttl, Download::Options options)
+{
+    auto dl = Download::makeCachedByteArray(url, output, ttl, options);
+    dl->addHeaderProxy(new ApiHeaderProxy());
+    return dl;
+}
+
 Download::Ptr ApiDownload::makeFile(QUrl url, QString path, Download::Options options)
 {
     auto dl = Download::makeFile(url, path, options);
@@ -43,4 +50,15 @@ Download::Ptr ApiDownload::makeFile(QUrl url, QString path, Download::Options op
     return dl;
 }
 
+Download::Ptr ApiDownload::makeStored(QUrl url,
+                                      QString path,
+                                      QCryptographicHash::Algorithm algorithm,
+                                      QByteArray hash,
+                                      Download::Options options)
+{
+    auto dl = Download::makeStored(url, path, algorithm, hash, options);
+    dl->addHeaderProxy(new ApiHeaderProxy());
+    return dl;
+}
+
 }  // namespace Net
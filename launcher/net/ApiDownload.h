@@ -26,7 +26,16 @@ namespace Net {
 namespace ApiDownload {
 Download::Ptr makeCached(QUrl url, MetaEntryPtr entry, Download::Options options = Download::Option::NoOptions);
 Download::Ptr makeByteArray(QUrl url, std::shared_ptr<QByteArray> output, Download::Options options = Download::Option::NoOptions);
+Download::Ptr makeCachedByteArray(QUrl url,
+                                  std::shared_ptr<QByteArray> output,
+                                  qint64 ttl,
+                                  Download::Options options = Download::Option::NoOptions);
 Download::Ptr makeFile(QUrl url, QString path, Download::Options options = Download::Option::NoOptions);
+Download::Ptr makeStored(QUrl url,
+                         QString path,
+                         QCryptographicHash::Algorithm algorithm,
+                         QByteArray hash,
+                         Download::Options options = Download::Option::NoOptions);
 };  // namespace ApiDownload
 
 }  // namespace Net
@@ -29,4 +29,11 @@ Upload::Ptr ApiUpload::makeByteArray(QUrl url, std::shared_ptr<QByteArray> outpu
     return up;
 }
 
+Upload::Ptr ApiUpload::makeCachedByteArray(QUrl url, std::shared_ptr<QByteArray> output, QByteArray m_post_data, qint64 ttl)
+{
+    auto up = Upload::makeCachedByteArray(url, output, m_post_data, ttl);
+    up->addHeaderProxy(new ApiHeaderProxy());
+    return up;
+}
+
 }  // namespace Net
@@ -25,6 +25,7 @@ namespace Net {
 
 namespace ApiUpload {
 Upload::Ptr makeByteArray(QUrl url, std::shared_ptr<QByteArray> output, QByteArray m_post_data);
+Upload::Ptr makeCachedByteArray(QUrl url, std::shared_ptr<QByteArray> output, QByteArray m_post_data, qint64 ttl);
 };
 
 }  // namespace Net
@@ -0,0 +1,60 @@
+// SPDX-License-Identifier: GPL-3.0-only
+/*
+ *  Prism Launcher - Minecraft Launcher
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, version 3.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "ContentStoreSink.h"
+
+#include <QFileInfo>
+
+#include "ChecksumValidator.h"
+#include "ContentStore.h"
+#include "FileSystem.h"
+
+#include "net/Logging.h"
+
+namespace Net {
+
+ContentStoreSink::ContentStoreSink(QString filename, QCryptographicHash::Algorithm algorithm, QByteArray hash)
+    : Net::FileSink(filename), m_algorithm(algorithm), m_hash(hash)
+{
+    addValidator(new ChecksumValidator(algorithm, hash));
+}
+
+Task::State ContentStoreSink::initCache(QNetworkRequest&)
+{
+    if (ContentStore::isStorable(m_filename) && ContentStore::materialize(m_algorithm, m_hash, m_filename)) {
+        qCDebug(taskNetLogC) << "Placed" << m_filename << "from the content store";
+        return Task::State::Succeeded;
+    }
+    return Task::State::Running;
+}
+
+Task::State ContentStoreSink::finalize(QNetworkReply& reply)
+{
+    // an older file shared through the store is a read-only hard link, which Windows won't let the download replace
+    if (wroteAnyData && QFileInfo::exists(m_filename) && !QFileInfo(m_filename).isWritable())
+        FS::deletePath(m_filename);
+    return FileSink::finalize(reply);
+}
+
+Task::State ContentStoreSink::finalizeCache(QNetworkReply&)
+{
+    // the checksum validator made sure the file is what the hash says it is
+    if (wroteAnyData && ContentStore::isStorable(m_filename))
+        ContentStore::add(m_algorithm, m_hash, m_filename);
+    return Task::State::Succeeded;
+}
+}  // namespace Net
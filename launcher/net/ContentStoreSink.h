@@ -0,0 +1,46 @@
+// SPDX-License-Identifier: GPL-3.0-only
+/*
+ *  Prism Launcher - Minecraft Launcher
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, version 3.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <QCryptographicHash>
+
+#include "FileSink.h"
+
+namespace Net {
+/**
+ * File sink backed by the content store.
+ *
+ * A file already in the store is placed at the target without being downloaded; a downloaded file is verified
+ * against the expected hash and added to the store. Targets the store doesn't take are only verified.
+ */
+class ContentStoreSink : public FileSink {
+   public:
+    ContentStoreSink(QString filename, QCryptographicHash::Algorithm algorithm, QByteArray hash);
+    virtual ~ContentStoreSink() = default;
+
+    auto finalize(QNetworkReply& reply) -> Task::State override;
+
+   protected:
+    auto initCache(QNetworkRequest& request) -> Task::State override;
+    auto finalizeCache(QNetworkReply& reply) -> Task::State override;
+
+   private:
+    QCryptographicHash::Algorithm m_algorithm;
+    QByteArray m_hash;
+};
+}  // namespace Net
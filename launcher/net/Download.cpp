@@ -46,9 +46,27 @@
 #include "ByteArraySink.h"
 #include "ChecksumValidator.h"
 #include "MetaCacheSink.h"
+#if defined(LAUNCHER_APPLICATION)
+#include "Application.h"
+#include "ContentStoreSink.h"
+#include "ResponseCacheSink.h"
+#endif
 
 namespace Net {
 
+// a transfer receiving less than s_stall_bytes for s_stall_checks checks in a row is stalled
+static const int s_stall_check_interval = 5000;
+static const int s_stall_checks = 3;
+static const qint64 s_stall_bytes = 4 * 1024;
+
+Download::Download() : NetRequest()
+{
+    logCat = taskDownloadLogC;
+    m_stall_timer.setInterval(s_stall_check_interval);
+    connect(&m_stall_timer, &QTimer::timeout, this, &Download::checkStall);
+    connect(this, &Task::finished, &m_stall_timer, &QTimer::stop);
+}
+
 #if defined(LAUNCHER_APPLICATION)
 auto Download::makeCached(QUrl url, MetaEntryPtr entry, Options options) -> Download::Ptr
 {
@@ -61,6 +79,27 @@ auto Download::makeCached(QUrl url, MetaEntryPtr entry, Options options) -> Down
     dl->m_sink.reset(cachedNode);
     return dl;
 }
+
+auto Download::makeStored(QUrl url, QString path, QCryptographicHash::Algorithm algorithm, QByteArray hash, Options options)
+    -> Download::Ptr
+{
+    auto dl = makeShared<Download>();
+    dl->m_url = url;
+    dl->setObjectName(QString("FILE:") + url.toString());
+    dl->m_options = options;
+    dl->m_sink.reset(new ContentStoreSink(path, algorithm, hash));
+    return dl;
+}
+
+auto Download::makeCachedByteArray(QUrl url, std::shared_ptr<QByteArray> output, qint64 ttl, Options options) -> Download::Ptr
+{
+    auto dl = makeShared<Download>();
+    dl->m_url = url;
+    dl->setObjectName(QString("BYTES:") + url.toString());
+    dl->m_options = options;
+    dl->m_sink.reset(new ResponseCacheSink(output, APPLICATION->responseCache(), ResponseCache::makeKey(url), ttl));
+    return dl;
+}
 #endif
 
 auto Download::makeByteArray(QUrl url, std::shared_ptr<QByteArray> output, Options options) -> Download::Ptr
@@ -85,6 +124,64 @@ auto Download::makeFile(QUrl url, QString path, Options options) -> Download::Pt
 
 QNetworkReply* Download::getReply(QNetworkRequest& request)
 {
-    return m_network->get(request);
+    auto reply = m_network->get(request);
+
+    m_received = 0;
+    m_received_at_check = 0;
+    m_slow_checks = 0;
+    connect(reply, &QNetworkReply::downloadProgress, this, [this](qint64 received) { m_received = received; });
+    m_stall_timer.start();
+
+    return reply;
+}
+
+void Download::checkStall()
+{
+    if (!m_reply || !m_reply->isRunning()) {
+        m_stall_timer.stop();
+        return;
+    }
+
+    auto received = m_received - m_received_at_check;
+    m_received_at_check = m_received;
+    if (received >= s_stall_bytes) {
+        m_slow_checks = 0;
+        return;
+    }
+    if (++m_slow_checks < s_stall_checks)
+        return;
+
+    if (m_mirrors.isEmpty()) {
+        // nowhere else to go, a slow transfer is better than none
+        if (m_restarted) {
+            m_slow_checks = 0;
+            return;
+        }
+        m_restarted = true;
+        m_mirrors.append(m_url);
+    }
+    qCWarning(logCat) << getUid().toString() << "Transfer stalled:" << m_url.toString();
+
+    // drop the stalled reply without going through the usual failure handling
+    m_stall_timer.stop();
+    auto reply = m_reply.take();
+    disconnect(reply, nullptr, this, nullptr);
+    reply->abort();
+    reply->deleteLater();
+    m_sink->abort();
+    failOver();
+}
+
+auto Download::failOver() -> bool
+{
+    m_stall_timer.stop();
+    if (m_mirrors.isEmpty() || getState() == State::AbortedByUser)
+        return false;
+
+    auto next = m_mirrors.takeFirst();
+    qCWarning(logCat) << getUid().toString() << "Failed to download" << m_url.toString() << "trying" << next.toString();
+    m_url = next;
+    executeTask();
+    return true;
 }
 }  // namespace Net
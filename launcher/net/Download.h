@@ -38,6 +38,9 @@
 
 #pragma once
 
+#include <QCryptographicHash>
+#include <QTimer>
+
 #include "HttpMetaCache.h"
 
 #include "QObjectPtr.h"
@@ -48,16 +51,46 @@ class Download : public NetRequest {
     Q_OBJECT
    public:
     using Ptr = shared_qobject_ptr<class Download>;
-    explicit Download() : NetRequest() { logCat = taskDownloadLogC; }
+    explicit Download();
 
 #if defined(LAUNCHER_APPLICATION)
     static auto makeCached(QUrl url, MetaEntryPtr entry, Options options = Option::NoOptions) -> Download::Ptr;
+    static auto makeStored(QUrl url,
+                           QString path,
+                           QCryptographicHash::Algorithm algorithm,
+                           QByteArray hash,
+                           Options options = Option::NoOptions) -> Download::Ptr;
+    /** Like makeByteArray, but answered from the API response cache while the cached response is younger than ttl seconds. */
+    static auto makeCachedByteArray(QUrl url, std::shared_ptr<QByteArray> output, qint64 ttl, Options options = Option::NoOptions)
+        -> Download::Ptr;
 #endif
 
     static auto makeByteArray(QUrl url, std::shared_ptr<QByteArray> output, Options options = Option::NoOptions) -> Download::Ptr;
     static auto makeFile(QUrl url, QString path, Options options = Option::NoOptions) -> Download::Ptr;
 
+    /**
+     * Adds another source for the same content, tried in the order they were added.
+     *
+     * The download moves on to the next source when the current one fails, or when it stalls: a transfer that stays
+     * below a minimal throughput for a while is dropped even if the server keeps the connection alive.
+     */
+    void addMirror(QUrl url) { m_mirrors.append(url); }
+
    protected:
     virtual QNetworkReply* getReply(QNetworkRequest&) override;
+    auto failOver() -> bool override;
+
+   private:
+    void checkStall();
+
+   private:
+    QList<QUrl> m_mirrors;
+    /// a stalled download without other sources gets one fresh connection to its own URL
+    bool m_restarted = false;
+
+    QTimer m_stall_timer;
+    qint64 m_received = 0;
+    qint64 m_received_at_check = 0;
+    int m_slow_checks = 0;
 };
 }  // namespace Net
@@ -52,6 +52,8 @@ class FileSink : public Sink {
 
     auto hasLocalData() -> bool override;
 
+    auto target() const -> QString override { return m_filename; }
+
    protected:
     virtual auto initCache(QNetworkRequest&) -> Task::State;
     virtual auto finalizeCache(QNetworkReply& reply) -> Task::State;
@@ -262,6 +262,9 @@ void HttpMetaCache::Load()
         foo->m_etag = Json::ensureString(element_obj, "etag");
         foo->m_local_changed_timestamp = Json::ensureDouble(element_obj, "last_changed_timestamp");
         foo->m_remote_changed_timestamp = Json::ensureString(element_obj, "remote_changed_timestamp");
+        foo->m_sha256sum = Json::ensureString(element_obj, "sha256sum");
+        foo->m_sha256_size = Json::ensureDouble(element_obj, "sha256_size");
+        foo->m_sha256_timestamp = Json::ensureDouble(element_obj, "sha256_timestamp");
 
         foo->makeEternal(Json::ensureBoolean(element_obj, (const QString)QStringLiteral("eternal"), false));
         if (!foo->isEternal()) {
@@ -309,6 +312,11 @@ void HttpMetaCache::SaveNow()
             entryObj.insert("last_changed_timestamp", QJsonValue(double(entry->m_local_changed_timestamp)));
             if (!entry->m_remote_changed_timestamp.isEmpty())
                 entryObj.insert("remote_changed_timestamp", QJsonValue(entry->m_remote_changed_timestamp));
+            if (!entry->m_sha256sum.isEmpty()) {
+                Json::writeString(entryObj, "sha256sum", entry->m_sha256sum);
+                entryObj.insert("sha256_size", QJsonValue(double(entry->m_sha256_size)));
+                entryObj.insert("sha256_timestamp", QJsonValue(double(entry->m_sha256_timestamp)));
+            }
             if (entry->isEternal()) {
                 entryObj.insert("eternal", true);
             } else {
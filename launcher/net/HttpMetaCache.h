@@ -64,6 +64,18 @@ class MetaEntry {
     auto getMD5Sum() -> QString { return m_md5sum; }
     void setMD5Sum(QString md5sum) { m_md5sum = md5sum; }
 
+    /* SHA-256 of the local file, empty unless it was recorded for a file of the same size and modification time. */
+    auto getSHA256Sum(qint64 size, qint64 timestamp) -> QString
+    {
+        return size == m_sha256_size && timestamp == m_sha256_timestamp ? m_sha256sum : QString();
+    }
+    void setSHA256Sum(QString sha256sum, qint64 size, qint64 timestamp)
+    {
+        m_sha256sum = sha256sum;
+        m_sha256_size = size;
+        m_sha256_timestamp = timestamp;
+    }
+
     /* Whether the entry expires after some time (false) or not (true). */
     void makeEternal(bool eternal) { m_is_eternal = eternal; }
     [[nodiscard]] bool isEternal() const { return m_is_eternal; }
@@ -82,6 +94,9 @@ class MetaEntry {
     QString m_relativePath;
     QString m_md5sum;
     QString m_etag;
+    QString m_sha256sum;
+    qint64 m_sha256_size = 0;
+    qint64 m_sha256_timestamp = 0;
 
     qint64 m_local_changed_timestamp = 0;
     QString m_remote_changed_timestamp;  // QString for now, RFC 2822 encoded time
@@ -41,6 +41,8 @@
 
 #include <QDateTime>
 #include <QFileInfo>
+#include <QHash>
+#include <QMutex>
 #include <QNetworkReply>
 #include <QUrl>
 #include <memory>
@@ -55,6 +57,15 @@
 
 namespace Net {
 
+// transfers in flight that other requests can share, by URL and target file
+static QMutex s_transfers_mutex;
+static QHash<QString, QPointer<NetRequest>> s_transfers;
+
+NetRequest::~NetRequest()
+{
+    releaseTransfer();
+}
+
 void NetRequest::addValidator(Validator* v)
 {
     m_sink->addValidator(v);
@@ -80,6 +91,8 @@ void NetRequest::executeTask()
             emit finished();
             return;
         case State::Running:
+            if (shareTransfer())
+                return;
             qCDebug(logCat) << getUid().toString() << "Runninng " << m_url.toString();
             break;
         case State::Inactive:
@@ -131,6 +144,80 @@ void NetRequest::executeTask()
     connect(rep, &QNetworkReply::readyRead, this, &NetRequest::downloadReadyRead);
 }
 
+auto NetRequest::shareTransfer() -> bool
+{
+    // already doing the transfer, e.g. when following a redirect
+    if (!m_transfer_key.isEmpty())
+        return false;
+
+    auto target = m_sink->target();
+    if (target.isEmpty())
+        return false;
+    auto key = m_url.toString() + '\n' + QFileInfo(target).absoluteFilePath();
+
+    QMutexLocker lock(&s_transfers_mutex);
+    auto leader = s_transfers.value(key);
+    if (!leader) {
+        s_transfers.insert(key, this);
+        m_transfer_key = key;
+        return false;
+    }
+    lock.unlock();
+
+    followTransfer(leader);
+    return true;
+}
+
+void NetRequest::followTransfer(NetRequest* leader)
+{
+    qCDebug(logCat) << getUid().toString() << "Sharing the transfer of" << leader->getUid().toString() << "for" << m_url.toString();
+
+    // the leader writes and validates the file, so this sink has nothing to do
+    m_sink->abort();
+    m_leader = leader;
+
+    connect(leader, &Task::progress, this, &Task::setProgress);
+    connect(leader, &Task::details, this, &Task::setDetails);
+    connect(leader, &Task::failed, this, [this](QString reason) { m_failReason = reason; });
+    connect(leader, &Task::finished, this, [this] {
+        auto state = m_leader->getState();
+        disconnect(m_leader, nullptr, this, nullptr);
+        m_leader = nullptr;
+
+        switch (state) {
+            case State::Succeeded:
+                m_state = State::Succeeded;
+                emit succeeded();
+                emit finished();
+                break;
+            case State::AbortedByUser:
+                // whoever started the transfer gave up on it, but this request still wants the file
+                executeTask();
+                break;
+            default:
+                m_state = State::Failed;
+                emit failed(m_failReason);
+                emit finished();
+                break;
+        }
+    });
+    connect(leader, &QObject::destroyed, this, [this] {
+        qCDebug(logCat) << getUid().toString() << "Shared transfer went away, starting over:" << m_url.toString();
+        executeTask();
+    });
+}
+
+void NetRequest::releaseTransfer()
+{
+    if (m_transfer_key.isEmpty())
+        return;
+
+    QMutexLocker lock(&s_transfers_mutex);
+    if (s_transfers.value(m_transfer_key) == this)
+        s_transfers.remove(m_transfer_key);
+    m_transfer_key.clear();
+}
+
 void NetRequest::onProgress(qint64 bytesReceived, qint64 bytesTotal)
 {
     auto now = m_clock.now();
@@ -265,6 +352,8 @@ void NetRequest::downloadFinished()
     } else if (m_state == State::Failed) {
         qCDebug(logCat) << getUid().toString() << "Request failed in previous step:" << m_url.toString();
         m_sink->abort();
+        if (failOver())
+            return;
         emit failed(m_reply->errorString());
         emit finished();
         return;
@@ -284,6 +373,8 @@ void NetRequest::downloadFinished()
         if (m_state != State::Succeeded) {
             qCDebug(logCat) << getUid().toString() << "Request failed to write:" << m_url.toString();
             m_sink->abort();
+            if (failOver())
+                return;
             emit failed("failed to write in sink");
             emit finished();
             return;
@@ -295,6 +386,8 @@ void NetRequest::downloadFinished()
     if (m_state != State::Succeeded) {
         qCDebug(logCat) << getUid().toString() << "Request failed to finalize:" << m_url.toString();
         m_sink->abort();
+        if (failOver())
+            return;
         emit failed("failed to finalize the request");
         emit finished();
         return;
@@ -322,6 +415,14 @@ void NetRequest::downloadReadyRead()
 auto NetRequest::abort() -> bool
 {
     m_state = State::AbortedByUser;
+    if (m_leader) {
+        // only stop waiting, the transfer may still be needed by others
+        disconnect(m_leader, nullptr, this, nullptr);
+        m_leader = nullptr;
+        emit aborted();
+        emit finished();
+        return true;
+    }
     if (m_reply) {
 #if QT_VERSION >= QT_VERSION_CHECK(5, 15, 0)  // QNetworkReply::errorOccurred added in 5.15
         disconnect(m_reply.get(), &QNetworkReply::errorOccurred, nullptr, nullptr);
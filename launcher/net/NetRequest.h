@@ -41,6 +41,7 @@
 
 #include <qloggingcategory.h>
 #include <QNetworkReply>
+#include <QPointer>
 #include <QUrl>
 #include <chrono>
 
@@ -56,7 +57,7 @@ namespace Net {
 class NetRequest : public Task {
     Q_OBJECT
    protected:
-    explicit NetRequest() : Task() {}
+    explicit NetRequest() : Task() { connect(this, &Task::finished, this, &NetRequest::releaseTransfer); }
 
    public:
     using Ptr = shared_qobject_ptr<class NetRequest>;
@@ -64,7 +65,7 @@ class NetRequest : public Task {
     Q_DECLARE_FLAGS(Options, Option)
 
    public:
-    ~NetRequest() override = default;
+    ~NetRequest() override;
     void addValidator(Validator* v);
     auto abort() -> bool override;
     auto canAbort() const -> bool override { return true; }
@@ -82,6 +83,12 @@ class NetRequest : public Task {
     auto handleRedirect() -> bool;
     virtual QNetworkReply* getReply(QNetworkRequest&) = 0;
 
+    // Requests for the same URL and target file share one transfer, even across jobs.
+    // The first one to start does the work, the others follow it and finish the same way.
+    auto shareTransfer() -> bool;
+    void followTransfer(NetRequest* leader);
+    void releaseTransfer();
+
    protected slots:
     void onProgress(qint64 bytesReceived, qint64 bytesTotal);
     void downloadError(QNetworkReply::NetworkError error);
@@ -90,6 +97,10 @@ class NetRequest : public Task {
     void downloadReadyRead();
     void executeTask() override;
 
+   protected:
+    /// called when the transfer failed, returns true if it was started again from another source
+    virtual auto failOver() -> bool { return false; }
+
    protected:
     std::unique_ptr<Sink> m_sink;
     Options m_options;
@@ -109,6 +120,12 @@ class NetRequest : public Task {
     /// source URL
     QUrl m_url;
     std::vector<std::shared_ptr<Net::HeaderProxy>> m_headerProxies;
+
+   private:
+    /// the key this request is doing a shared transfer for
+    QString m_transfer_key;
+    /// the request doing the transfer this one is waiting for
+    QPointer<NetRequest> m_leader;
 };
 }  // namespace Net
 
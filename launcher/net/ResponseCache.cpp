@@ -0,0 +1,143 @@
+// SPDX-License-Identifier: GPL-3.0-only
+/*
+ *  Prism Launcher - Minecraft Launcher
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, version 3.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "ResponseCache.h"
+
+#include <QCryptographicHash>
+#include <QDataStream>
+#include <QDateTime>
+#include <QDebug>
+#include <QDir>
+#include <QDirIterator>
+#include <QFile>
+#include <QSaveFile>
+#include <QUrlQuery>
+
+#include <algorithm>
+
+#include "FileSystem.h"
+
+namespace Net {
+
+// bump when the layout of the files changes, older files are then ignored
+static const quint32 s_format_version = 1;
+
+// responses not used for this long are removed from the disk
+static const qint64 s_max_disk_age = 7 * 24 * 60 * 60;
+
+ResponseCache::ResponseCache(QString path, int memory_limit) : m_path(std::move(path)), m_memory(memory_limit)
+{
+    auto oldest = QDateTime::currentDateTimeUtc().addSecs(-s_max_disk_age);
+    QDirIterator it(m_path, QDir::Files);
+    while (it.hasNext()) {
+        it.next();
+        if (it.fileInfo().lastModified().toUTC() < oldest)
+            QFile::remove(it.filePath());
+    }
+}
+
+ResponseCache::~ResponseCache()
+{
+    qDebug() << "API response cache:" << m_stats.hits << "hits," << m_stats.revalidated << "revalidated," << m_stats.misses << "misses";
+}
+
+QString ResponseCache::makeKey(QUrl url, const QByteArray& body)
+{
+    url = url.adjusted(QUrl::NormalizePathSegments | QUrl::StripTrailingSlash | QUrl::RemoveFragment);
+
+    QUrlQuery query(url);
+    auto items = query.queryItems(QUrl::FullyEncoded);
+    std::sort(items.begin(), items.end());
+    query.setQueryItems(items);
+    url.setQuery(query);
+
+    auto key = url.toString(QUrl::FullyEncoded);
+    if (!body.isEmpty())
+        key += ' ' + QString::fromLatin1(QCryptographicHash::hash(body, QCryptographicHash::Sha1).toHex());
+    return key;
+}
+
+QString ResponseCache::filePath(const QString& key) const
+{
+    return FS::PathCombine(m_path, QString::fromLatin1(QCryptographicHash::hash(key.toUtf8(), QCryptographicHash::Sha1).toHex()));
+}
+
+std::optional<ResponseCache::Entry> ResponseCache::find(const QString& key)
+{
+    if (auto* entry = m_memory.object(key))
+        return *entry;
+
+    QFile file(filePath(key));
+    if (!file.open(QFile::ReadOnly))
+        return {};
+
+    QDataStream in(&file);
+    quint32 version;
+    QString stored_key;
+    Entry entry;
+    in >> version;
+    if (version != s_format_version)
+        return {};
+    in >> stored_key >> entry.etag >> entry.fetched >> entry.data;
+    if (in.status() != QDataStream::Ok || stored_key != key)
+        return {};
+
+    m_memory.insert(key, new Entry(entry), entry.data.size());
+    return entry;
+}
+
+void ResponseCache::revalidate(const QString& key)
+{
+    m_stats.revalidated++;
+    auto entry = find(key);
+    if (!entry)
+        return;
+    entry->fetched = QDateTime::currentSecsSinceEpoch();
+    m_memory.insert(key, new Entry(*entry), entry->data.size());
+    write(key, *entry);
+}
+
+void ResponseCache::insert(const QString& key, const QByteArray& data, const QByteArray& etag)
+{
+    m_stats.misses++;
+    Entry entry{ data, etag, QDateTime::currentSecsSinceEpoch() };
+    m_memory.insert(key, new Entry(entry), data.size());
+    write(key, entry);
+}
+
+void ResponseCache::write(const QString& key, const Entry& entry)
+{
+    auto path = filePath(key);
+    if (!FS::ensureFilePathExists(path))
+        return;
+
+    QSaveFile file(path);
+    if (!file.open(QFile::WriteOnly))
+        return;
+    QDataStream out(&file);
+    out << s_format_version << key << entry.etag << entry.fetched << entry.data;
+    if (!file.commit())
+        qWarning() << "Failed to write API response cache entry" << path;
+}
+
+void ResponseCache::evictAll()
+{
+    m_memory.clear();
+    FS::deletePath(m_path);
+}
+
+}  // namespace Net
@@ -0,0 +1,76 @@
+// SPDX-License-Identifier: GPL-3.0-only
+/*
+ *  Prism Launcher - Minecraft Launcher
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, version 3.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <QByteArray>
+#include <QCache>
+#include <QString>
+#include <QUrl>
+
+#include <optional>
+
+namespace Net {
+/**
+ * Short-lived cache for API responses, kept in memory and mirrored on disk.
+ *
+ * Entries are keyed by the normalized request, so the same search or project lookup done twice within its
+ * time to live is answered without touching the network. Expired entries are kept around to revalidate them
+ * with their ETag.
+ */
+class ResponseCache {
+   public:
+    struct Entry {
+        QByteArray data;
+        QByteArray etag;
+        qint64 fetched = 0;  // seconds since epoch
+    };
+
+    struct Stats {
+        int hits = 0;
+        int revalidated = 0;
+        int misses = 0;
+    };
+
+    explicit ResponseCache(QString path, int memory_limit = 32 * 1024 * 1024);
+    ~ResponseCache();
+
+    /** Key for a request: the URL with its query sorted, plus a digest of the body for POST requests. */
+    static QString makeKey(QUrl url, const QByteArray& body = {});
+
+    std::optional<Entry> find(const QString& key);
+
+    /** A fresh entry was served without a request. */
+    void recordHit() { m_stats.hits++; }
+    /** The server answered 304 for the entry, so it is fresh again. */
+    void revalidate(const QString& key);
+    /** A new response was downloaded. */
+    void insert(const QString& key, const QByteArray& data, const QByteArray& etag);
+
+    void evictAll();
+
+    Stats stats() const { return m_stats; }
+
+   private:
+    QString filePath(const QString& key) const;
+    void write(const QString& key, const Entry& entry);
+
+    QString m_path;
+    QCache<QString, Entry> m_memory;
+    Stats m_stats;
+};
+}  // namespace Net
@@ -0,0 +1,64 @@
+// SPDX-License-Identifier: GPL-3.0-only
+/*
+ *  Prism Launcher - Minecraft Launcher
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, version 3.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "ResponseCacheSink.h"
+
+#include <QDateTime>
+
+namespace Net {
+
+ResponseCacheSink::ResponseCacheSink(std::shared_ptr<QByteArray> output, std::shared_ptr<ResponseCache> cache, QString key, qint64 ttl)
+    : ByteArraySink(std::move(output)), m_cache(std::move(cache)), m_key(std::move(key)), m_ttl(ttl)
+{}
+
+Task::State ResponseCacheSink::init(QNetworkRequest& request)
+{
+    auto state = ByteArraySink::init(request);
+    if (state != Task::State::Running || !m_output)
+        return state;
+
+    m_stale = m_cache->find(m_key);
+    if (!m_stale)
+        return state;
+
+    if (QDateTime::currentSecsSinceEpoch() - m_stale->fetched < m_ttl) {
+        *m_output = m_stale->data;
+        m_cache->recordHit();
+        return Task::State::Succeeded;
+    }
+
+    if (!m_stale->etag.isEmpty())
+        request.setRawHeader("If-None-Match", m_stale->etag);
+    return state;
+}
+
+Task::State ResponseCacheSink::finalize(QNetworkReply& reply)
+{
+    auto status = reply.attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
+    if (status == 304 && m_stale) {
+        *m_output = m_stale->data;
+        m_cache->revalidate(m_key);
+        return Task::State::Succeeded;
+    }
+
+    auto state = ByteArraySink::finalize(reply);
+    if (state == Task::State::Succeeded && status == 200)
+        m_cache->insert(m_key, *m_output, reply.rawHeader("ETag"));
+    return state;
+}
+
+}  // namespace Net
@@ -0,0 +1,46 @@
+// SPDX-License-Identifier: GPL-3.0-only
+/*
+ *  Prism Launcher - Minecraft Launcher
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, version 3.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <optional>
+
+#include "ByteArraySink.h"
+#include "ResponseCache.h"
+
+namespace Net {
+/**
+ * Byte array sink answering from the API response cache.
+ *
+ * A cached response younger than the time to live is returned without a request. An older one is revalidated
+ * with its ETag, and reused if the server says it did not change.
+ */
+class ResponseCacheSink : public ByteArraySink {
+   public:
+    ResponseCacheSink(std::shared_ptr<QByteArray> output, std::shared_ptr<ResponseCache> cache, QString key, qint64 ttl);
+    virtual ~ResponseCacheSink() = default;
+
+    auto init(QNetworkRequest& request) -> Task::State override;
+    auto finalize(QNetworkReply& reply) -> Task::State override;
+
+   private:
+    std::shared_ptr<ResponseCache> m_cache;
+    QString m_key;
+    qint64 m_ttl;
+    std::optional<ResponseCache::Entry> m_stale;
+};
+}  // namespace Net
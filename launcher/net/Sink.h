@@ -52,6 +52,9 @@ class Sink {
 
     virtual auto hasLocalData() -> bool = 0;
 
+    /** Where the sink puts its output, if it is a file. Requests for the same URL and target share a single transfer. */
+    virtual auto target() const -> QString { return {}; }
+
     void addValidator(Validator* validator)
     {
         if (validator) {
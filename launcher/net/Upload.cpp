@@ -40,7 +40,9 @@
 
 #include <memory>
 #include <utility>
+#include "Application.h"
 #include "ByteArraySink.h"
+#include "ResponseCacheSink.h"
 
 namespace Net {
 
@@ -59,4 +61,14 @@ Upload::Ptr Upload::makeByteArray(QUrl url, std::shared_ptr<QByteArray> output,
     up->m_post_data = std::move(m_post_data);
     return up;
 }
+
+Upload::Ptr Upload::makeCachedByteArray(QUrl url, std::shared_ptr<QByteArray> output, QByteArray m_post_data, qint64 ttl)
+{
+    auto up = makeShared<Upload>();
+    auto key = ResponseCache::makeKey(url, m_post_data);
+    up->m_url = std::move(url);
+    up->m_sink.reset(new ResponseCacheSink(output, APPLICATION->responseCache(), key, ttl));
+    up->m_post_data = std::move(m_post_data);
+    return up;
+}
 }  // namespace Net
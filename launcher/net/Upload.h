@@ -48,6 +48,8 @@ class Upload : public NetRequest {
     explicit Upload() : NetRequest() { logCat = taskUploadLogC; };
 
     static Upload::Ptr makeByteArray(QUrl url, std::shared_ptr<QByteArray> output, QByteArray m_post_data);
+    /** Like makeByteArray, but answered from the API response cache while the cached response is younger than ttl seconds. */
+    static Upload::Ptr makeCachedByteArray(QUrl url, std::shared_ptr<QByteArray> output, QByteArray m_post_data, qint64 ttl);
 
    protected:
     virtual QNetworkReply* getReply(QNetworkRequest&) override;
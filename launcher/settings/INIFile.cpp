@@ -37,39 +37,577 @@
 #include "settings/INIFile.h"
 #include <FileSystem.h>
 
+#include <QDataStream>
 #include <QDebug>
 #include <QFile>
+#include <QPoint>
+#include <QRect>
+#include <QSize>
 #include <QStringList>
-#include <QTemporaryFile>
 #include <QTextStream>
 
-#include <QSettings>
+// The reader and writer below follow what QSettings does for QSettings::IniFormat (see qsettings.cpp), so files written by
+// older versions of the launcher load unchanged and the other way around. Only the parts we need are implemented:
+// no locking, no merging with the file on disk, keys are case sensitive and values are read as UTF-8.
+namespace {
 
-INIFile::INIFile() {}
+#ifdef Q_OS_WIN
+const char* const s_eol = "\r\n";
+#else
+const char* const s_eol = "\n";
+#endif
 
-bool INIFile::saveFile(QString fileName)
+bool isSpace(char ch)
 {
-    if (!contains("ConfigVersion"))
-        insert("ConfigVersion", "1.2");
-    QSettings _settings_obj{ fileName, QSettings::Format::IniFormat };
-    _settings_obj.setFallbacksEnabled(false);
-    _settings_obj.clear();
+    return ch == ' ' || ch == '\t' || ch == '\n' || ch == '\r' || ch == '\v' || ch == '\f';
+}
+
+bool isHexDigit(char16_t ch)
+{
+    return (ch >= '0' && ch <= '9') || (ch >= 'a' && ch <= 'f') || (ch >= 'A' && ch <= 'F');
+}
 
-    for (Iterator iter = begin(); iter != end(); iter++)
-        _settings_obj.setValue(iter.key(), iter.value());
+int hexValue(char ch)
+{
+    if (ch >= '0' && ch <= '9')
+        return ch - '0';
+    if (ch >= 'a' && ch <= 'f')
+        return ch - 'a' + 10;
+    return ch - 'A' + 10;
+}
 
-    _settings_obj.sync();
+char toHexUpper(uint value)
+{
+    return "0123456789ABCDEF"[value & 0xF];
+}
 
-    if (auto status = _settings_obj.status(); status != QSettings::Status::NoError) {
-        // Shouldn't be possible!
-        Q_ASSERT(status != QSettings::Status::FormatError);
+QString variantToString(const QVariant& value)
+{
+    switch (value.userType()) {
+        case QMetaType::UnknownType:
+            return "@Invalid()";
+        case QMetaType::QByteArray:
+            return "@ByteArray(" + QString::fromLatin1(value.toByteArray()) + ")";
+        case QMetaType::QString:
+        case QMetaType::LongLong:
+        case QMetaType::ULongLong:
+        case QMetaType::Int:
+        case QMetaType::UInt:
+        case QMetaType::Bool:
+        case QMetaType::Float:
+        case QMetaType::Double: {
+            auto result = value.toString();
+            if (result.contains(QChar::Null))
+                return "@String(" + result + ")";
+            if (result.startsWith('@'))
+                result.prepend('@');
+            return result;
+        }
+        case QMetaType::QRect: {
+            auto rect = value.toRect();
+            return QString("@Rect(%1 %2 %3 %4)").arg(rect.x()).arg(rect.y()).arg(rect.width()).arg(rect.height());
+        }
+        case QMetaType::QSize: {
+            auto size = value.toSize();
+            return QString("@Size(%1 %2)").arg(size.width()).arg(size.height());
+        }
+        case QMetaType::QPoint: {
+            auto point = value.toPoint();
+            return QString("@Point(%1 %2)").arg(point.x()).arg(point.y());
+        }
+        default: {
+            QByteArray data;
+            QDataStream stream(&data, QIODevice::WriteOnly);
+            stream.setVersion(QDataStream::Qt_4_0);
+            stream << value;
+            return "@Variant(" + QString::fromLatin1(data) + ")";
+        }
+    }
+}
 
-        if (status == QSettings::Status::AccessError)
-            qCritical() << "An access error occurred (e.g. trying to write to a read-only file).";
+QVariant stringToVariant(const QString& str)
+{
+    if (str.startsWith('@')) {
+        if (str.endsWith(')')) {
+            if (str.startsWith("@ByteArray(")) {
+                return QVariant(str.mid(11, str.size() - 12).toLatin1());
+            } else if (str.startsWith("@String(")) {
+                return QVariant(str.mid(8, str.size() - 9));
+            } else if (str.startsWith("@Variant(") || str.startsWith("@DateTime(")) {
+                auto offset = str.startsWith("@Variant(") ? 9 : 10;
+                QByteArray data = str.mid(offset, str.size() - offset - 1).toLatin1();
+                QDataStream stream(&data, QIODevice::ReadOnly);
+                stream.setVersion(QDataStream::Qt_4_0);
+                QVariant result;
+                stream >> result;
+                return result;
+            } else if (str.startsWith("@Rect(")) {
+                auto args = str.mid(6, str.size() - 7).split(' ');
+                if (args.size() == 4)
+                    return QVariant(QRect(args[0].toInt(), args[1].toInt(), args[2].toInt(), args[3].toInt()));
+            } else if (str.startsWith("@Size(")) {
+                auto args = str.mid(6, str.size() - 7).split(' ');
+                if (args.size() == 2)
+                    return QVariant(QSize(args[0].toInt(), args[1].toInt()));
+            } else if (str.startsWith("@Point(")) {
+                auto args = str.mid(7, str.size() - 8).split(' ');
+                if (args.size() == 2)
+                    return QVariant(QPoint(args[0].toInt(), args[1].toInt()));
+            } else if (str == "@Invalid()") {
+                return QVariant();
+            }
+        }
+        if (str.startsWith("@@"))
+            return QVariant(str.mid(1));
+    }
+    return QVariant(str);
+}
 
-        return false;
+QVariant stringListToVariant(QStringList list)
+{
+    for (auto& str : list) {
+        if (!str.startsWith('@'))
+            continue;
+        if (str.size() < 2 || str.at(1) != '@') {
+            QVariantList variantList;
+            variantList.reserve(list.size());
+            for (auto& item : list)
+                variantList.append(stringToVariant(item));
+            return variantList;
+        }
+        str.remove(0, 1);
     }
+    return list;
+}
 
+void escapeKey(const QString& key, QByteArray& result)
+{
+    for (auto qch : key) {
+        uint ch = qch.unicode();
+        if (ch == '/') {
+            result += '\\';
+        } else if ((ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z') || (ch >= '0' && ch <= '9') || ch == '_' || ch == '-' ||
+                   ch == '.') {
+            result += char(ch);
+        } else if (ch <= 0xFF) {
+            result += '%';
+            result += toHexUpper(ch >> 4);
+            result += toHexUpper(ch);
+        } else {
+            result += "%U";
+            result += toHexUpper(ch >> 12);
+            result += toHexUpper(ch >> 8);
+            result += toHexUpper(ch >> 4);
+            result += toHexUpper(ch);
+        }
+    }
+}
+
+QString unescapeKey(const QByteArray& key)
+{
+    const QString decoded = QString::fromUtf8(key);
+    QString result;
+    result.reserve(decoded.size());
+    for (int i = 0; i < decoded.size();) {
+        auto ch = decoded.at(i);
+        if (ch == '\\') {
+            result += '/';
+            ++i;
+            continue;
+        }
+        if (ch != '%' || i == decoded.size() - 1) {
+            result += ch;
+            ++i;
+            continue;
+        }
+
+        int numDigits = 2;
+        int firstDigitPos = i + 1;
+        if (decoded.at(firstDigitPos) == 'U') {
+            ++firstDigitPos;
+            numDigits = 4;
+        }
+        bool ok = firstDigitPos + numDigits <= decoded.size();
+        ushort value = ok ? decoded.mid(firstDigitPos, numDigits).toUShort(&ok, 16) : 0;
+        if (!ok) {
+            result += '%';
+            ++i;
+            continue;
+        }
+        result += QChar(value);
+        i = firstDigitPos + numDigits;
+    }
+    return result;
+}
+
+void escapeString(const QString& str, QByteArray& result)
+{
+    bool needsQuotes = false;
+    bool escapeNextIfDigit = false;
+#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+    // these carry binary data that has to stay 8-bit clean
+    bool useUtf8 = !(str.startsWith("@ByteArray(") || str.startsWith("@Variant("));
+#else
+    // QSettings in Qt 5 escapes everything outside of ASCII when no INI codec is set, keep the files readable for it
+    bool useUtf8 = false;
+#endif
+    auto startPos = result.size();
+
+    for (int i = 0; i < str.size(); ++i) {
+        auto qch = str.at(i);
+        uint ch = qch.unicode();
+        if (ch == ';' || ch == ',' || ch == '=')
+            needsQuotes = true;
+
+        if (escapeNextIfDigit && isHexDigit(ch)) {
+            result += "\\x" + QByteArray::number(ch, 16);
+            continue;
+        }
+        escapeNextIfDigit = false;
+
+        switch (ch) {
+            case '\0':
+                result += "\\0";
+                escapeNextIfDigit = true;
+                break;
+            case '\a':
+                result += "\\a";
+                break;
+            case '\b':
+                result += "\\b";
+                break;
+            case '\f':
+                result += "\\f";
+                break;
+            case '\n':
+                result += "\\n";
+                break;
+            case '\r':
+                result += "\\r";
+                break;
+            case '\t':
+                result += "\\t";
+                break;
+            case '\v':
+                result += "\\v";
+                break;
+            case '"':
+            case '\\':
+                result += '\\';
+                result += char(ch);
+                break;
+            default:
+                if (ch <= 0x1F || (ch >= 0x7F && !useUtf8)) {
+                    result += "\\x" + QByteArray::number(ch, 16);
+                    escapeNextIfDigit = true;
+                } else if (ch >= 0x7F) {
+                    // keep surrogate pairs together so they end up as a single UTF-8 sequence
+                    int length = qch.isHighSurrogate() && i + 1 < str.size() && str.at(i + 1).isLowSurrogate() ? 2 : 1;
+                    result += str.mid(i, length).toUtf8();
+                    i += length - 1;
+                } else {
+                    result += char(ch);
+                }
+        }
+    }
+
+    if (needsQuotes || (startPos < result.size() && (result.at(startPos) == ' ' || result.at(result.size() - 1) == ' '))) {
+        result.insert(startPos, '"');
+        result += '"';
+    }
+}
+
+void escapeStringList(const QStringList& list, QByteArray& result)
+{
+    // an empty list must not read back as a list with one empty string
+    if (list.isEmpty()) {
+        result += "@Invalid()";
+        return;
+    }
+    for (int i = 0; i < list.size(); ++i) {
+        if (i != 0)
+            result += ", ";
+        escapeString(list.at(i), result);
+    }
+}
+
+void chopTrailingSpaces(QString& str, int limit)
+{
+    int n = str.size() - 1;
+    while (n >= limit && (str.at(n) == ' ' || str.at(n) == '\t'))
+        str.truncate(n--);
+}
+
+char escapeCode(char ch)
+{
+    switch (ch) {
+        case 'a':
+            return '\a';
+        case 'b':
+            return '\b';
+        case 'f':
+            return '\f';
+        case 'n':
+            return '\n';
+        case 'r':
+            return '\r';
+        case 't':
+            return '\t';
+        case 'v':
+            return '\v';
+        case '"':
+        case '?':
+        case '\'':
+        case '\\':
+            return ch;
+        default:
+            return 0;
+    }
+}
+
+/** Unescapes a value, returns true if it turned out to be a comma separated list (which then ends up in 'list'). */
+bool unescapeValue(const char* str, int size, QString& result, QStringList& list)
+{
+    bool isStringList = false;
+    bool inQuotedString = false;
+    bool currentValueIsQuoted = false;
+    int i = 0;
+    int chopLimit = 0;
+
+    auto skipSpaces = [&] {
+        while (i < size && (str[i] == ' ' || str[i] == '\t'))
+            ++i;
+        chopLimit = result.size();
+    };
+    auto finish = [&](bool chop) {
+        if (chop && !currentValueIsQuoted)
+            chopTrailingSpaces(result, chopLimit);
+        if (isStringList)
+            list.append(result);
+        return isStringList;
+    };
+
+    skipSpaces();
+    while (i < size) {
+        char ch = str[i];
+        if (ch == '\\') {
+            if (++i >= size)
+                return finish(false);
+            ch = str[i++];
+            if (auto code = escapeCode(ch)) {
+                result += QLatin1Char(code);
+            } else if (ch == 'x' || (ch >= '0' && ch <= '7')) {
+                const bool hex = ch == 'x';
+                char16_t value = hex ? 0 : ch - '0';
+                if (hex && (i >= size || !isHexDigit(str[i]))) {
+                    if (i >= size)
+                        return finish(false);
+                    chopLimit = result.size();
+                    continue;
+                }
+                while (i < size && (hex ? isHexDigit(str[i]) : (str[i] >= '0' && str[i] <= '7'))) {
+                    value = char16_t(hex ? (value << 4) + hexValue(str[i]) : (value << 3) + (str[i] - '0'));
+                    ++i;
+                }
+                result += QChar(value);
+            } else if (ch == '\n' || ch == '\r') {
+                // an escaped line break continues the value on the next line
+                if (i < size && (str[i] == '\n' || str[i] == '\r') && str[i] != ch)
+                    ++i;
+            }
+            chopLimit = result.size();
+        } else if (ch == '"') {
+            ++i;
+            currentValueIsQuoted = true;
+            inQuotedString = !inQuotedString;
+            if (!inQuotedString)
+                skipSpaces();
+        } else if (ch == ',' && !inQuotedString) {
+            if (!currentValueIsQuoted)
+                chopTrailingSpaces(result, chopLimit);
+            if (!isStringList) {
+                isStringList = true;
+                list.clear();
+            }
+            list.append(result);
+            result.clear();
+            currentValueIsQuoted = false;
+            ++i;
+            skipSpaces();
+        } else {
+            int j = i + 1;
+            while (j < size && str[j] != '\\' && str[j] != '"' && str[j] != ',')
+                ++j;
+            result += QString::fromUtf8(str + i, j - i);
+            i = j;
+        }
+    }
+    return finish(true);
+}
+
+/**
+ * Finds the next logical line starting at 'dataPos', skipping blank lines and comments.
+ * Quoted and escaped line breaks do not end a line. Returns false once there are no more lines.
+ */
+bool readLine(const QByteArray& data, int& dataPos, int& lineStart, int& lineLen, int& equalsPos)
+{
+    const int dataLen = data.size();
+    bool inQuotes = false;
+    equalsPos = -1;
+
+    lineStart = dataPos;
+    while (lineStart < dataLen && isSpace(data.at(lineStart)))
+        ++lineStart;
+
+    int i = lineStart;
+    while (i < dataLen) {
+        char ch = data.at(i++);
+        if (ch == '=') {
+            if (!inQuotes && equalsPos == -1)
+                equalsPos = i - 1;
+        } else if (ch == '\n' || ch == '\r') {
+            if (i == lineStart + 1) {
+                ++lineStart;
+            } else if (!inQuotes) {
+                --i;
+                break;
+            }
+        } else if (ch == '\\') {
+            if (i < dataLen) {
+                char escaped = data.at(i++);
+                if (i < dataLen) {
+                    char next = data.at(i);
+                    if ((escaped == '\n' && next == '\r') || (escaped == '\r' && next == '\n'))
+                        ++i;
+                }
+            }
+        } else if (ch == '"') {
+            inQuotes = !inQuotes;
+        } else if (ch == ';') {
+            if (i == lineStart + 1) {
+                // a comment line
+                while (i < dataLen && data.at(i) != '\n' && data.at(i) != '\r')
+                    ++i;
+                while (i < dataLen && isSpace(data.at(i)))
+                    ++i;
+                lineStart = i;
+            } else if (!inQuotes) {
+                // a trailing comment ends the line, it is skipped as a comment line on the next call
+                --i;
+                break;
+            }
+        }
+    }
+
+    dataPos = i;
+    lineLen = i - lineStart;
+    return lineLen > 0;
+}
+
+/** Parses INI data into 'map', keys of sections other than [General] are prefixed with "section/". */
+bool parseIni(const QByteArray& data, QVariantMap& map)
+{
+    bool ok = true;
+    QString section;
+    int dataPos = data.startsWith("\xef\xbb\xbf") ? 3 : 0;
+    int lineStart, lineLen, equalsPos;
+
+    while (readLine(data, dataPos, lineStart, lineLen, equalsPos)) {
+        if (data.at(lineStart) == '[') {
+            auto end = data.indexOf(']', lineStart);
+            QByteArray name;
+            if (end == -1 || end >= lineStart + lineLen) {
+                ok = false;
+                name = data.mid(lineStart + 1, lineLen - 1);
+            } else {
+                name = data.mid(lineStart + 1, end - lineStart - 1);
+            }
+            name = name.trimmed();
+            if (name.compare("general", Qt::CaseInsensitive) == 0) {
+                section.clear();
+            } else {
+                section = name.compare("%general", Qt::CaseInsensitive) == 0 ? QString::fromLatin1(name.mid(1)) : unescapeKey(name);
+                section += '/';
+            }
+            continue;
+        }
+
+        if (equalsPos == -1) {
+            ok = false;
+            continue;
+        }
+
+        auto key = section + unescapeKey(data.mid(lineStart, equalsPos - lineStart).trimmed());
+        auto valueStart = equalsPos + 1;
+        QString value;
+        QStringList list;
+        if (unescapeValue(data.constData() + valueStart, lineStart + lineLen - valueStart, value, list))
+            map.insert(key, stringListToVariant(list));
+        else
+            map.insert(key, stringToVariant(value));
+    }
+    return ok;
+}
+
+QByteArray serialize(const QVariantMap& map)
+{
+    // keys with a slash go into a section named after the part before it, like QSettings does
+    QMap<QString, QVariantMap> sections;
+    for (auto iter = map.begin(); iter != map.end(); iter++) {
+        auto slashPos = iter.key().indexOf('/');
+        if (slashPos == -1)
+            sections[QString()].insert(iter.key(), iter.value());
+        else
+            sections[iter.key().left(slashPos)].insert(iter.key().mid(slashPos + 1), iter.value());
+    }
+
+    QByteArray data;
+    for (auto section = sections.begin(); section != sections.end(); section++) {
+        if (section != sections.begin())
+            data += s_eol;
+        if (section.key().isEmpty()) {
+            data += "[General]";
+        } else if (section.key().compare("general", Qt::CaseInsensitive) == 0) {
+            data += "[%General]";
+        } else {
+            data += '[';
+            escapeKey(section.key(), data);
+            data += ']';
+        }
+        data += s_eol;
+
+        for (auto iter = section->begin(); iter != section->end(); iter++) {
+            escapeKey(iter.key(), data);
+            data += '=';
+            auto& value = iter.value();
+            if (value.userType() == QMetaType::QStringList || (value.userType() == QMetaType::QVariantList && value.toList().size() != 1)) {
+                QStringList list;
+                for (auto& item : value.toList())
+                    list.append(variantToString(item));
+                escapeStringList(list, data);
+            } else {
+                escapeString(variantToString(value), data);
+            }
+            data += s_eol;
+        }
+    }
+    return data;
+}
+}  // namespace
+
+INIFile::INIFile() {}
+
+bool INIFile::saveFile(QString fileName)
+{
+    if (!contains("ConfigVersion"))
+        insert("ConfigVersion", "1.2");
+
+    try {
+        FS::write(fileName, serialize(*this));
+    } catch (const FS::FileSystemException& e) {
+        qCritical() << "Failed to save" << fileName << ":" << e.cause();
+        return false;
+    }
     return true;
 }
 
@@ -113,9 +651,9 @@ QString unquote(QString str)
     return str;
 }
 
-bool parseOldFileFormat(QIODevice& device, QSettings::SettingsMap& map)
+bool parseOldFileFormat(const QByteArray& data, QVariantMap& map)
 {
-    QTextStream in(device.readAll());
+    QTextStream in(data);
 #if QT_VERSION <= QT_VERSION_CHECK(6, 0, 0)
     in.setCodec("UTF-8");
 #endif
@@ -151,55 +689,42 @@ bool parseOldFileFormat(QIODevice& device, QSettings::SettingsMap& map)
 
 bool INIFile::loadFile(QString fileName)
 {
-    QSettings _settings_obj{ fileName, QSettings::Format::IniFormat };
-    _settings_obj.setFallbacksEnabled(false);
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadOnly))
+        return false;
+    return loadFile(file.readAll());
+}
 
-    if (auto status = _settings_obj.status(); status != QSettings::Status::NoError) {
-        if (status == QSettings::Status::AccessError)
-            qCritical() << "An access error occurred (e.g. trying to write to a read-only file).";
-        if (status == QSettings::Status::FormatError)
-            qCritical() << "A format error occurred (e.g. loading a malformed INI file).";
+bool INIFile::loadFile(QByteArray data)
+{
+    QVariantMap map;
+    if (!parseIni(data, map)) {
+        qCritical() << "A format error occurred (e.g. loading a malformed INI file).";
         return false;
     }
-    if (!_settings_obj.value("ConfigVersion").isValid()) {
-        QFile file(fileName);
-        if (!file.open(QIODevice::ReadOnly))
-            return false;
-        QSettings::SettingsMap map;
-        parseOldFileFormat(file, map);
-        file.close();
-        for (auto&& key : map.keys())
-            insert(key, map.value(key));
+
+    if (!map.value("ConfigVersion").isValid()) {
+        QVariantMap oldMap;
+        parseOldFileFormat(data, oldMap);
+        for (auto iter = oldMap.begin(); iter != oldMap.end(); iter++)
+            insert(iter.key(), iter.value());
         insert("ConfigVersion", "1.2");
-    } else if (_settings_obj.value("ConfigVersion").toString() == "1.1") {
-        for (auto&& key : _settings_obj.allKeys()) {
-            if (auto valueStr = _settings_obj.value(key).toString();
+    } else if (map.value("ConfigVersion").toString() == "1.1") {
+        for (auto iter = map.begin(); iter != map.end(); iter++) {
+            if (auto valueStr = iter.value().toString();
                 (valueStr.contains(QChar(';')) || valueStr.contains(QChar('=')) || valueStr.contains(QChar(','))) &&
                 valueStr.endsWith("\"") && valueStr.startsWith("\"")) {
-                insert(key, unquote(valueStr));
+                insert(iter.key(), unquote(valueStr));
             } else
-                insert(key, _settings_obj.value(key));
+                insert(iter.key(), iter.value());
         }
         insert("ConfigVersion", "1.2");
     } else
-        for (auto&& key : _settings_obj.allKeys())
-            insert(key, _settings_obj.value(key));
+        for (auto iter = map.begin(); iter != map.end(); iter++)
+            insert(iter.key(), iter.value());
     return true;
 }
 
-bool INIFile::loadFile(QByteArray data)
-{
-    QTemporaryFile file;
-    if (!file.open())
-        return false;
-    file.write(data);
-    file.flush();
-    file.close();
-    auto loaded = loadFile(file.fileName());
-    file.remove();
-    return loaded;
-}
-
 QVariant INIFile::get(QString key, QVariant def) const
 {
     if (!this->contains(key))
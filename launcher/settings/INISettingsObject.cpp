@@ -17,7 +17,35 @@
 #include "Setting.h"
 
 #include <QDebug>
+#include <QDir>
 #include <QFile>
+#include <QFileInfo>
+#include <QThreadPool>
+#include <QtConcurrent>
+
+namespace {
+QThreadPool* writerPool()
+{
+    // a single thread, so writes to the same file always land in the order they were made.
+    // never torn down, saveNow() waits for everything that is still in flight.
+    static QThreadPool* pool = [] {
+        auto pool = new QThreadPool();
+        pool->setMaxThreadCount(1);
+        return pool;
+    }();
+    return pool;
+}
+
+void writeFile(INIFile contents, const QString& filePath)
+{
+    // don't bring back the folder of an instance that was deleted while the write was pending
+    if (!QFileInfo(filePath).dir().exists()) {
+        qWarning() << "Not saving" << filePath << "because its folder is gone";
+        return;
+    }
+    contents.saveFile(filePath);
+}
+}  // namespace
 
 INISettingsObject::INISettingsObject(QStringList paths, QObject* parent) : SettingsObject(parent)
 {
@@ -36,21 +64,44 @@ INISettingsObject::INISettingsObject(QStringList paths, QObject* parent) : Setti
 
     m_filePath = first_path;
     m_ini.loadFile(first_path);
+    setupSaveTimer();
 }
 
 INISettingsObject::INISettingsObject(QString path, QObject* parent) : SettingsObject(parent)
 {
     m_filePath = path;
     m_ini.loadFile(path);
+    setupSaveTimer();
+}
+
+INISettingsObject::INISettingsObject(QString path, const INIFile& contents, QObject* parent) : SettingsObject(parent)
+{
+    m_filePath = path;
+    m_ini = contents;
+    setupSaveTimer();
+}
+
+INISettingsObject::~INISettingsObject()
+{
+    saveNow();
+}
+
+void INISettingsObject::setupSaveTimer()
+{
+    m_saveTimer.setSingleShot(true);
+    m_saveTimer.setInterval(500);
+    connect(&m_saveTimer, &QTimer::timeout, this, &INISettingsObject::saveInBackground);
 }
 
 void INISettingsObject::setFilePath(const QString& filePath)
 {
+    saveNow();
     m_filePath = filePath;
 }
 
 bool INISettingsObject::reload()
 {
+    saveNow();
     return m_ini.loadFile(m_filePath) && SettingsObject::reload();
 }
 
@@ -63,8 +114,32 @@ void INISettingsObject::resumeSave()
 {
     m_suspendSave = false;
     if (m_doSave) {
-        m_ini.saveFile(m_filePath);
+        m_doSave = false;
+        doSave();
+    }
+}
+
+void INISettingsObject::saveNow()
+{
+    m_saveTimer.stop();
+    m_pendingWrite.waitForFinished();
+    if (m_dirty) {
+        m_dirty = false;
+        writeFile(m_ini, m_filePath);
+    }
+}
+
+void INISettingsObject::saveInBackground()
+{
+    if (!m_dirty)
+        return;
+    // only one write per file in flight, otherwise an older one could overwrite the newer one
+    if (!m_pendingWrite.isFinished()) {
+        m_saveTimer.start();
+        return;
     }
+    m_dirty = false;
+    m_pendingWrite = QtConcurrent::run(writerPool(), writeFile, m_ini, m_filePath);
 }
 
 void INISettingsObject::changeSetting(const Setting& setting, QVariant value)
@@ -91,7 +166,9 @@ void INISettingsObject::doSave()
     if (m_suspendSave) {
         m_doSave = true;
     } else {
-        m_ini.saveFile(m_filePath);
+        // settings are usually changed a bunch at a time, write them out together
+        m_dirty = true;
+        m_saveTimer.start();
     }
 }
 
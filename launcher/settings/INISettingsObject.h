@@ -17,6 +17,9 @@
 
 #include <QObject>
 
+#include <QFuture>
+#include <QTimer>
+
 #include "settings/INIFile.h"
 
 #include "settings/SettingsObject.h"
@@ -32,6 +35,11 @@ class INISettingsObject : public SettingsObject {
 
     explicit INISettingsObject(QString path, QObject* parent = nullptr);
 
+    /** Uses the already loaded contents of the INI file at 'path', so it can be parsed ahead of time. */
+    explicit INISettingsObject(QString path, const INIFile& contents, QObject* parent = nullptr);
+
+    virtual ~INISettingsObject();
+
     /*!
      * \brief Gets the path to the INI file.
      * \return The path to the INI file.
@@ -46,8 +54,15 @@ class INISettingsObject : public SettingsObject {
 
     bool reload() override;
 
+    /** The current in-memory contents of the INI file. */
+    const INIFile& contents() const { return m_ini; }
+
+    /** Whether there are changes that were not handed to the writer yet. */
+    bool hasUnsavedChanges() const { return m_dirty || m_doSave; }
+
     void suspendSave() override;
     void resumeSave() override;
+    void saveNow() override;
 
    protected slots:
     virtual void changeSetting(const Setting& setting, QVariant value) override;
@@ -57,7 +72,19 @@ class INISettingsObject : public SettingsObject {
     virtual QVariant retrieveValue(const Setting& setting) override;
     void doSave();
 
+   private slots:
+    void saveInBackground();
+
+   private:
+    void setupSaveTimer();
+
    protected:
     INIFile m_ini;
     QString m_filePath;
+
+   private:
+    /// changes are collected for a short while and then written out together
+    QTimer m_saveTimer;
+    QFuture<void> m_pendingWrite;
+    bool m_dirty = false;
 };
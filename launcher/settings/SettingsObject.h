@@ -141,6 +141,11 @@ class SettingsObject : public QObject {
 
     virtual void suspendSave() = 0;
     virtual void resumeSave() = 0;
+
+    /*!
+     * \brief Writes out any changes that are still waiting to be saved and blocks until that is done.
+     */
+    virtual void saveNow() = 0;
    signals:
     /*!
      * \brief Signal emitted when one of this SettingsObject object's settings changes.
@@ -0,0 +1,143 @@
+// SPDX-License-Identifier: GPL-3.0-only
+/*
+ *  Prism Launcher - Minecraft Launcher
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, version 3.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "ImageLoader.h"
+
+#include <QApplication>
+#include <QDebug>
+#include <QImageReader>
+#include <QThread>
+#include <QtConcurrentRun>
+
+#include <algorithm>
+
+// decoded thumbnails kept around, in KiB
+static const int s_thumbnail_cache_size = 64 * 1024;
+
+// how long to gather decoded images before handing them to the GUI, in milliseconds
+static const int s_deliver_interval = 16;
+
+static QImage readImage(const QString& path, QSize size)
+{
+    QImageReader reader(path);
+    reader.setAutoTransform(true);
+
+    if (size.isValid()) {
+        // let the reader scale while decoding, which is a lot cheaper for formats that support it
+        auto original = reader.size();
+        if (original.isValid() && (original.width() > size.width() || original.height() > size.height()))
+            reader.setScaledSize(original.scaled(size, Qt::KeepAspectRatio));
+    }
+
+    auto image = reader.read();
+    if (image.isNull())
+        qWarning() << "Failed to decode image" << path << ":" << reader.errorString();
+    return image;
+}
+
+ImageLoader* ImageLoader::instance()
+{
+    static auto* s_instance = new ImageLoader(qApp);
+    return s_instance;
+}
+
+ImageLoader::ImageLoader(QObject* parent) : QObject(parent), m_thumbnails(s_thumbnail_cache_size)
+{
+    m_pool.setMaxThreadCount(std::max(2, QThread::idealThreadCount() / 2));
+
+    m_deliver_timer.setSingleShot(true);
+    m_deliver_timer.setInterval(s_deliver_interval);
+    connect(&m_deliver_timer, &QTimer::timeout, this, &ImageLoader::deliver);
+}
+
+ImageLoader::~ImageLoader()
+{
+    m_pool.clear();
+    m_pool.waitForDone();
+}
+
+std::optional<QPixmap> ImageLoader::thumbnail(const QString& key)
+{
+    if (auto* pixmap = m_thumbnails.object(key))
+        return *pixmap;
+    return {};
+}
+
+void ImageLoader::loadThumbnail(const QString& key, const QString& path, QSize size, QObject* context, PixmapCallback callback)
+{
+    if (auto pixmap = thumbnail(key)) {
+        callback(*pixmap);
+        return;
+    }
+    decode(key, path, size, { context, std::move(callback), {} });
+}
+
+void ImageLoader::loadImage(const QString& path, QObject* context, ImageCallback callback)
+{
+    // the newline can't be part of a path, so these don't clash with thumbnail keys
+    decode("\n" + path, path, {}, { context, {}, std::move(callback) });
+}
+
+void ImageLoader::decode(const QString& key, const QString& path, QSize size, Waiter waiter)
+{
+    auto& waiters = m_waiting[key];
+    waiters.append(std::move(waiter));
+
+    // already being decoded for someone else
+    if (waiters.size() > 1)
+        return;
+
+    QtConcurrent::run(&m_pool, [this, key, path, size] {
+        auto image = readImage(path, size);
+        QMetaObject::invokeMethod(this, [this, key, image] { decoded(key, image); }, Qt::QueuedConnection);
+    });
+}
+
+void ImageLoader::decoded(const QString& key, const QImage& image)
+{
+    m_decoded.append({ key, image });
+    if (!m_deliver_timer.isActive())
+        m_deliver_timer.start();
+}
+
+void ImageLoader::deliver()
+{
+    auto decoded = std::move(m_decoded);
+    m_decoded.clear();
+
+    for (auto& result : decoded) {
+        auto& key = result.first;
+        auto& image = result.second;
+        auto waiters = m_waiting.take(key);
+
+        QPixmap pixmap;
+        bool is_thumbnail = std::any_of(waiters.begin(), waiters.end(), [](const Waiter& waiter) { return bool(waiter.on_pixmap); });
+        if (is_thumbnail && !image.isNull()) {
+            pixmap = QPixmap::fromImage(image);
+            m_thumbnails.insert(key, new QPixmap(pixmap), std::max(1, int(image.sizeInBytes() / 1024)));
+        }
+
+        for (auto& waiter : waiters) {
+            if (!waiter.context)
+                continue;
+            if (waiter.on_pixmap)
+                waiter.on_pixmap(pixmap);
+            if (waiter.on_image)
+                waiter.on_image(image);
+        }
+    }
+}
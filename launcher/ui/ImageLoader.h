@@ -0,0 +1,83 @@
+// SPDX-License-Identifier: GPL-3.0-only
+/*
+ *  Prism Launcher - Minecraft Launcher
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, version 3.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <QCache>
+#include <QHash>
+#include <QImage>
+#include <QObject>
+#include <QPixmap>
+#include <QPointer>
+#include <QThreadPool>
+#include <QTimer>
+
+#include <functional>
+#include <optional>
+
+/**
+ * Decodes images in the background, so icons and screenshots arriving from the network don't stall the GUI.
+ *
+ * Images are read and scaled on worker threads. The results are handed back to the GUI thread in batches,
+ * where thumbnails are turned into pixmaps and kept in a size-bounded cache shared by every page.
+ */
+class ImageLoader : public QObject {
+    Q_OBJECT
+   public:
+    using ImageCallback = std::function<void(const QImage&)>;
+    using PixmapCallback = std::function<void(const QPixmap&)>;
+
+    static ImageLoader* instance();
+
+    ~ImageLoader() override;
+
+    /** The cached thumbnail for the key, if it was decoded before and is still in the cache. */
+    std::optional<QPixmap> thumbnail(const QString& key);
+
+    /** Decodes the image at path, scaled down to fit in size, and caches it under the key.
+     *
+     *  The callback gets a null pixmap if the image can't be read, and is not called at all if the context
+     *  object is destroyed before the image is ready.
+     */
+    void loadThumbnail(const QString& key, const QString& path, QSize size, QObject* context, PixmapCallback callback);
+
+    /** Decodes the whole image at path, without caching it. */
+    void loadImage(const QString& path, QObject* context, ImageCallback callback);
+
+   private:
+    explicit ImageLoader(QObject* parent);
+
+    struct Waiter {
+        QPointer<QObject> context;
+        PixmapCallback on_pixmap;
+        ImageCallback on_image;
+    };
+
+    void decode(const QString& key, const QString& path, QSize size, Waiter waiter);
+    void decoded(const QString& key, const QImage& image);
+    void deliver();
+
+   private:
+    QThreadPool m_pool;
+    QTimer m_deliver_timer;
+
+    // cost is in KiB
+    QCache<QString, QPixmap> m_thumbnails;
+
+    QHash<QString, QList<Waiter>> m_waiting;
+    QList<QPair<QString, QImage>> m_decoded;
+};
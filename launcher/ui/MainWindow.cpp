@@ -40,7 +40,9 @@
 
 #include "Application.h"
 #include "BuildConfig.h"
+#include "ContentStore.h"
 #include "FileSystem.h"
+#include "StringUtils.h"
 
 #include "MainWindow.h"
 #include "ui_MainWindow.h"
@@ -85,6 +87,7 @@
 #include <minecraft/auth/AccountList.h>
 #include <net/ApiDownload.h>
 #include <net/NetJob.h>
+#include <net/ResponseCache.h>
 #include <news/NewsChecker.h>
 #include <tools/BaseProfiler.h>
 #include <updater/ExternalUpdater.h>
@@ -100,6 +103,7 @@
 #include "ui/dialogs/NewInstanceDialog.h"
 #include "ui/dialogs/NewsDialog.h"
 #include "ui/dialogs/ProgressDialog.h"
+#include "ui/dialogs/ScrollMessageBox.h"
 #include "ui/instanceview/InstanceDelegate.h"
 #include "ui/instanceview/InstanceProxyModel.h"
 #include "ui/instanceview/InstanceView.h"
@@ -116,6 +120,7 @@
 #include "minecraft/mod/TexturePackFolderModel.h"
 #include "minecraft/mod/tasks/LocalResourceParse.h"
 
+#include "modplatform/BulkCheckUpdateTask.h"
 #include "modplatform/ModIndex.h"
 #include "modplatform/flame/FlameAPI.h"
 #include "modplatform/flame/FlameModIndex.h"
@@ -403,6 +408,11 @@ MainWindow::MainWindow(QWidget* parent) : QMainWindow(parent), ui(new Ui::MainWi
     connect(ui->actionUndoTrashInstance, &QAction::triggered, this, &MainWindow::undoTrashInstance);
 
     setSelectedInstanceById(APPLICATION->settings()->get("SelectedInstance").toString());
+    // instances may still be read in the background, the last selected one is selected once it shows up
+    connect(APPLICATION->instances().get(), &QAbstractItemModel::rowsInserted, this, [this] {
+        if (!m_selectedInstance)
+            setSelectedInstanceById(APPLICATION->settings()->get("SelectedInstance").toString());
+    });
 
     // removing this looks stupid
     view->setFocus();
@@ -1294,6 +1304,82 @@ void MainWindow::on_actionClearMetadata_triggered()
 {
     APPLICATION->metacache()->evictAll();
     APPLICATION->metacache()->SaveNow();
+    APPLICATION->responseCache()->evictAll();
+}
+
+void MainWindow::on_actionRefreshInstanceMetadata_triggered()
+{
+    QList<InstancePtr> instances;
+    for (int i = 0; i < APPLICATION->instances()->count(); i++)
+        instances.append(APPLICATION->instances()->at(i));
+
+    auto task = PackProfile::prefetchMeta(instances);
+    ProgressDialog progress(this);
+    progress.setSkipButton(true, tr("Abort"));
+    progress.execWithTask(task.get());
+    if (!task->wasSuccessful()) {
+        if (task->getState() == Task::State::Failed)
+            CustomMessageBox::selectable(this, tr("Failed to refresh metadata"), task->failReason(), QMessageBox::Critical)->show();
+        return;
+    }
+
+    // everything the components need is loaded now, so resolving them doesn't touch the network again
+    for (auto& instance : instances) {
+        auto minecraft = std::dynamic_pointer_cast<MinecraftInstance>(instance);
+        if (minecraft && !minecraft->isRunning() && !minecraft->getPackProfile()->getCurrentTask())
+            minecraft->getPackProfile()->resolve(Net::Mode::Offline);
+    }
+}
+
+void MainWindow::on_actionCleanUpContentStore_triggered()
+{
+    auto result = ContentStore::collectGarbage();
+    QMessageBox::information(this, tr("Content store cleaned up"),
+                             tr("Removed %n unused file(s), freeing %1.", "", result.removedFiles)
+                                 .arg(StringUtils::humanReadableFileSize(result.freedBytes)));
+}
+
+void MainWindow::on_actionCheckModUpdates_triggered()
+{
+    QList<InstancePtr> instances;
+    for (int i = 0; i < APPLICATION->instances()->count(); i++)
+        instances.append(APPLICATION->instances()->at(i));
+
+    auto task = makeShared<BulkCheckUpdateTask>(instances);
+    ProgressDialog progress(this);
+    progress.setSkipButton(true, tr("Abort"));
+    progress.execWithTask(task.get());
+    if (!task->wasSuccessful()) {
+        // an aborted check has nothing to report
+        if (task->getState() == Task::State::Failed)
+            CustomMessageBox::selectable(this, tr("Failed to check for mod updates"), task->failReason(), QMessageBox::Critical)->show();
+        return;
+    }
+
+    QString text;
+    int outdated = 0;
+    for (auto& result : task->results()) {
+        if (result.updates.isEmpty() && result.unavailable.isEmpty())
+            continue;
+        text += QString("<b>%1</b><ul>").arg(result.instanceName.toHtmlEscaped());
+        for (auto& update : result.updates) {
+            text += QString("<li>%1 (%2) &rarr; %3</li>")
+                        .arg(update.name.toHtmlEscaped(), update.fileName.toHtmlEscaped(), update.newVersion.toHtmlEscaped());
+        }
+        for (auto& name : result.unavailable)
+            text += tr("<li>%1: no compatible version found</li>").arg(name.toHtmlEscaped());
+        text += "</ul>";
+        outdated += result.updates.size();
+    }
+
+    if (text.isEmpty()) {
+        QMessageBox::information(this, tr("Mod updates"), tr("All mods are up to date."));
+        return;
+    }
+    ScrollMessageBox message_dialog(this, tr("Mod updates"),
+                                    tr("Found %n outdated mod(s). Update them from the Mods page of each instance.", "", outdated),
+                                    text);
+    message_dialog.exec();
 }
 
 #ifdef Q_OS_MAC
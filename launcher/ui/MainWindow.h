@@ -136,6 +136,12 @@ class MainWindow : public QMainWindow {
 
     void on_actionClearMetadata_triggered();
 
+    void on_actionRefreshInstanceMetadata_triggered();
+
+    void on_actionCleanUpContentStore_triggered();
+
+    void on_actionCheckModUpdates_triggered();
+
 #ifdef Q_OS_MAC
     void on_actionAddToPATH_triggered();
 #endif
@@ -335,9 +335,6 @@ auto ModUpdateDialog::ensureMetadata() -> bool
         connect(modrinth_task.get(), &EnsureMetadataTask::failed,
                 [this](QString reason) { CustomMessageBox::selectable(this, tr("Error"), reason, QMessageBox::Critical)->exec(); });
 
-        if (modrinth_task->getHashingTask())
-            seq.addTask(modrinth_task->getHashingTask());
-
         seq.addTask(modrinth_task);
     }
 
@@ -350,9 +347,6 @@ auto ModUpdateDialog::ensureMetadata() -> bool
         connect(flame_task.get(), &EnsureMetadataTask::failed,
                 [this](QString reason) { CustomMessageBox::selectable(this, tr("Error"), reason, QMessageBox::Critical)->exec(); });
 
-        if (flame_task->getHashingTask())
-            seq.addTask(flame_task->getHashingTask());
-
         seq.addTask(flame_task);
     }
 
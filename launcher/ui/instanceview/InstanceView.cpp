@@ -47,6 +47,7 @@
 #include <QPersistentModelIndex>
 #include <QScrollBar>
 #include <QtMath>
+#include <algorithm>
 
 #include "VisualGroup.h"
 #include "ui/themes/ThemeManager.h"
@@ -85,26 +86,65 @@ void InstanceView::setModel(QAbstractItemModel* model)
     QAbstractItemView::setModel(model);
     connect(model, &QAbstractItemModel::modelReset, this, &InstanceView::modelReset);
     connect(model, &QAbstractItemModel::rowsRemoved, this, &InstanceView::rowsRemoved);
+    // the rows got shuffled around, which is as good as a reset for the layout
+    connect(model, &QAbstractItemModel::layoutChanged, this, &InstanceView::modelReset);
+    connect(model, &QAbstractItemModel::rowsMoved, this, &InstanceView::modelReset);
 }
 
-void InstanceView::dataChanged([[maybe_unused]] const QModelIndex& topLeft,
-                               [[maybe_unused]] const QModelIndex& bottomRight,
-                               [[maybe_unused]] const QVector<int>& roles)
+void InstanceView::dataChanged(const QModelIndex& topLeft, const QModelIndex& bottomRight, const QVector<int>& roles)
 {
+    // progress is painted over the item and does not affect the layout
+    auto isProgressRole = [](int role) {
+        return role == InstanceViewRoles::ProgressValueRole || role == InstanceViewRoles::ProgressMaximumRole;
+    };
+    if (!roles.isEmpty() && std::all_of(roles.begin(), roles.end(), isProgressRole)) {
+        viewport()->update();
+        return;
+    }
+    for (int row = topLeft.row(); row <= bottomRight.row(); row++) {
+        const QString groupName = model()->index(row, 0).data(InstanceViewRoles::GroupRole).toString();
+        m_dirtyGroups.insert(groupName);
+        if (row < m_rowGroups.size()) {
+            // the item may have moved to another group
+            m_dirtyGroups.insert(m_rowGroups[row]);
+            m_rowGroups[row] = groupName;
+        } else {
+            m_relayoutAll = true;
+        }
+    }
     scheduleDelayedItemsLayout();
 }
-void InstanceView::rowsInserted([[maybe_unused]] const QModelIndex& parent, [[maybe_unused]] int start, [[maybe_unused]] int end)
+void InstanceView::rowsInserted([[maybe_unused]] const QModelIndex& parent, int start, int end)
 {
+    if (start > m_rowGroups.size()) {
+        m_relayoutAll = true;
+    }
+    for (int row = start; row <= end; row++) {
+        const QString groupName = model()->index(row, 0).data(InstanceViewRoles::GroupRole).toString();
+        m_dirtyGroups.insert(groupName);
+        if (!m_relayoutAll) {
+            m_rowGroups.insert(row, groupName);
+        }
+    }
     scheduleDelayedItemsLayout();
 }
 
-void InstanceView::rowsAboutToBeRemoved([[maybe_unused]] const QModelIndex& parent, [[maybe_unused]] int start, [[maybe_unused]] int end)
+void InstanceView::rowsAboutToBeRemoved([[maybe_unused]] const QModelIndex& parent, int start, int end)
 {
+    for (int row = start; row <= end; row++) {
+        m_dirtyGroups.insert(model()->index(row, 0).data(InstanceViewRoles::GroupRole).toString());
+    }
+    if (end < m_rowGroups.size()) {
+        m_rowGroups.erase(m_rowGroups.begin() + start, m_rowGroups.begin() + end + 1);
+    } else {
+        m_relayoutAll = true;
+    }
     scheduleDelayedItemsLayout();
 }
 
 void InstanceView::modelReset()
 {
+    m_relayoutAll = true;
     scheduleDelayedItemsLayout();
 }
 
@@ -174,29 +214,46 @@ void InstanceView::updateGeometries()
 {
     geometryCache.clear();
 
-    QMap<LocaleString, VisualGroup*> cats;
-
+    // sort the items into their groups in a single pass over the model
+    QMap<LocaleString, QList<QModelIndex>> groupItems;
+    QStringList rowGroups;
     for (int i = 0; i < model()->rowCount(); ++i) {
-        const QString groupName = model()->index(i, 0).data(InstanceViewRoles::GroupRole).toString();
-        if (!cats.contains(groupName)) {
-            VisualGroup* old = this->category(groupName);
-            if (old) {
-                auto cat = new VisualGroup(old);
-                cats.insert(groupName, cat);
-                cat->update();
-            } else {
-                auto cat = new VisualGroup(groupName, this);
-                if (fVisibility) {
-                    cat->collapsed = fVisibility(groupName);
-                }
-                cats.insert(groupName, cat);
-                cat->update();
+        const QModelIndex index = model()->index(i, 0);
+        const QString groupName = index.data(InstanceViewRoles::GroupRole).toString();
+        groupItems[groupName].append(index);
+        rowGroups.append(groupName);
+    }
+
+    QList<VisualGroup*> groups;
+    QHash<QString, VisualGroup*> groupIndex;
+    for (auto iter = groupItems.cbegin(); iter != groupItems.cend(); ++iter) {
+        const QString& groupName = iter.key();
+        const auto& items = iter.value();
+        VisualGroup* cat = m_groupIndex.take(groupName);
+        if (!cat) {
+            cat = new VisualGroup(groupName, this);
+            if (fVisibility) {
+                cat->collapsed = fVisibility(groupName);
             }
+            cat->update(items);
+        } else if (m_relayoutAll || m_dirtyGroups.contains(groupName) || cat->m_itemsPerRow != itemsPerRow() ||
+                   cat->itemCount() != items.size()) {
+            cat->update(items);
+        } else {
+            // nothing in the group changed, only the rows of its items may have shifted
+            cat->reassign(items);
         }
+        groups.append(cat);
+        groupIndex.insert(groupName, cat);
     }
 
-    qDeleteAll(m_groups);
-    m_groups = cats.values();
+    // the groups left over have no items anymore
+    qDeleteAll(m_groupIndex);
+    m_groups = groups;
+    m_groupIndex = groupIndex;
+    m_rowGroups = rowGroups;
+    m_dirtyGroups.clear();
+    m_relayoutAll = false;
     updateScrollbar();
     viewport()->update();
 }
@@ -218,12 +275,7 @@ VisualGroup* InstanceView::category(const QModelIndex& index) const
 
 VisualGroup* InstanceView::category(const QString& cat) const
 {
-    for (auto group : m_groups) {
-        if (group->text == cat) {
-            return group;
-        }
-    }
-    return nullptr;
+    return m_groupIndex.value(cat, nullptr);
 }
 
 VisualGroup* InstanceView::categoryAt(const QPoint& pos, VisualGroup::HitResults& result) const
@@ -373,7 +425,9 @@ void InstanceView::mouseReleaseEvent(QMouseEvent* event)
             m_pressedCategory->collapsed = false;
             emit groupStateChanged(m_pressedCategory->text, false);
 
-            updateGeometries();
+            // only the height of the group changes, its rows stay the same
+            geometryCache.clear();
+            updateScrollbar();
             viewport()->update();
             event->accept();
             m_pressedCategory = nullptr;
@@ -383,7 +437,9 @@ void InstanceView::mouseReleaseEvent(QMouseEvent* event)
             m_pressedCategory->collapsed = true;
             emit groupStateChanged(m_pressedCategory->text, true);
 
-            updateGeometries();
+            // only the height of the group changes, its rows stay the same
+            geometryCache.clear();
+            updateScrollbar();
             viewport()->update();
             event->accept();
             m_pressedCategory = nullptr;
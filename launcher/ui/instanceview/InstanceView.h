@@ -36,9 +36,11 @@
 #pragma once
 
 #include <QCache>
+#include <QHash>
 #include <QLineEdit>
 #include <QListView>
 #include <QScrollBar>
+#include <QSet>
 #include <functional>
 #include "VisualGroup.h"
 
@@ -115,6 +117,13 @@ class InstanceView : public QAbstractItemView {
    private:
     friend struct VisualGroup;
     QList<VisualGroup*> m_groups;
+    /// the groups by name
+    QHash<QString, VisualGroup*> m_groupIndex;
+    /// the group of every model row, kept in sync with the model between layouts
+    QStringList m_rowGroups;
+    /// the groups whose items changed since the last layout, only those are flowed again
+    QSet<QString> m_dirtyGroups;
+    bool m_relayoutAll = true;
 
     visibilityFunction fVisibility;
 
@@ -47,12 +47,11 @@
 
 VisualGroup::VisualGroup(QString text, InstanceView* view) : view(view), text(std::move(text)), collapsed(false) {}
 
-VisualGroup::VisualGroup(const VisualGroup* other) : view(other->view), text(other->text), collapsed(other->collapsed) {}
-
-void VisualGroup::update()
+void VisualGroup::update(const QList<QModelIndex>& temp_items)
 {
-    auto temp_items = items();
     auto itemsPerRow = view->itemsPerRow();
+    m_itemsPerRow = itemsPerRow;
+    m_positions.clear();
 
     int numRows = qMax(1, qCeil((qreal)temp_items.size() / (qreal)itemsPerRow));
     rows = QVector<VisualRow>(numRows);
@@ -84,6 +83,7 @@ void VisualGroup::update()
         if (itemHeight > maxRowHeight) {
             maxRowHeight = itemHeight;
         }
+        m_positions.insert(item.row(), qMakePair(rows[currentRow].items.size(), currentRow));
         rows[currentRow].items.append(item);
         positionInRow++;
     }
@@ -91,16 +91,29 @@ void VisualGroup::update()
     rows[currentRow].top = offsetFromTop;
 }
 
-QPair<int, int> VisualGroup::positionOf(const QModelIndex& index) const
+void VisualGroup::reassign(const QList<QModelIndex>& items)
 {
-    int y = 0;
-    for (auto& row : rows) {
-        for (auto x = 0; x < row.items.size(); x++) {
-            if (row.items[x] == index) {
-                return qMakePair(x, y);
-            }
+    m_positions.clear();
+    auto item = items.cbegin();
+    for (int y = 0; y < rows.size(); y++) {
+        auto& row = rows[y];
+        for (int x = 0; x < row.items.size() && item != items.cend(); x++, item++) {
+            row.items[x] = *item;
+            m_positions.insert(item->row(), qMakePair(x, y));
         }
-        y++;
+    }
+}
+
+int VisualGroup::itemCount() const
+{
+    return m_positions.size();
+}
+
+QPair<int, int> VisualGroup::positionOf(const QModelIndex& index) const
+{
+    auto position = m_positions.constFind(index.row());
+    if (position != m_positions.constEnd() && rows[position->second].items[position->first] == index) {
+        return *position;
     }
     qWarning() << "Item" << index.row() << index.data(Qt::DisplayRole).toString() << "not found in visual group" << text;
     return qMakePair(0, 0);
@@ -259,11 +272,8 @@ int VisualGroup::verticalPosition() const
 QList<QModelIndex> VisualGroup::items() const
 {
     QList<QModelIndex> indices;
-    for (int i = 0; i < view->model()->rowCount(); ++i) {
-        const QModelIndex index = view->model()->index(i, 0);
-        if (index.data(InstanceViewRoles::GroupRole).toString() == text) {
-            indices.append(index);
-        }
+    for (auto& row : rows) {
+        indices.append(row.items);
     }
     return indices;
 }
@@ -35,6 +35,7 @@
 
 #pragma once
 
+#include <QHash>
 #include <QRect>
 #include <QString>
 #include <QStyleOption>
@@ -55,7 +56,6 @@ struct VisualRow {
 struct VisualGroup {
     /* constructors */
     VisualGroup(QString text, InstanceView* view);
-    explicit VisualGroup(const VisualGroup* other);
 
     /* data */
     InstanceView* view = nullptr;
@@ -64,10 +64,21 @@ struct VisualGroup {
     QVector<VisualRow> rows;
     int firstItemIndex = 0;
     int m_verticalPosition = 0;
+    /// items per row the rows were flowed with
+    int m_itemsPerRow = -1;
+    /// position of every item (in items!) by model row
+    QHash<int, QPair<int, int>> m_positions;
 
     /* logic */
-    /// update the internal list of items and flow them into the rows.
-    void update();
+    /// set the list of items and flow them into the rows.
+    void update(const QList<QModelIndex>& items);
+
+    /// replace the items with the given ones, which must lay out exactly like the current ones.
+    /// used when only the model rows of the items changed, so the rows do not need to be flowed again.
+    void reassign(const QList<QModelIndex>& items);
+
+    /// the number of items in the group
+    int itemCount() const;
 
     /// draw the header at y-position.
     void drawHeader(QPainter* painter, const QStyleOptionViewItem& option) const;
@@ -40,10 +40,12 @@
 
 #include "Application.h"
 
-#include <QIdentityProxyModel>
+#include <QFileDialog>
+#include <QFutureWatcher>
 #include <QScrollBar>
 #include <QShortcut>
 
+#include "FileSystem.h"
 #include "launch/LaunchTask.h"
 #include "settings/Setting.h"
 
@@ -52,90 +54,81 @@
 
 #include <BuildConfig.h>
 
-class LogFormatProxyModel : public QIdentityProxyModel {
-   public:
-    LogFormatProxyModel(QObject* parent = nullptr) : QIdentityProxyModel(parent) {}
-    QVariant data(const QModelIndex& index, int role) const override
-    {
-        const LogColors& colors = APPLICATION->themeManager()->getLogColors();
+QVariant LogFormatProxyModel::data(const QModelIndex& index, int role) const
+{
+    const LogColors& colors = APPLICATION->themeManager()->getLogColors();
 
-        switch (role) {
-            case Qt::FontRole:
-                return m_font;
-            case Qt::ForegroundRole: {
-                auto level = static_cast<MessageLevel::Enum>(QIdentityProxyModel::data(index, LogModel::LevelRole).toInt());
-                QColor result = colors.foreground.value(level);
+    switch (role) {
+        case Qt::FontRole:
+            return m_font;
+        case Qt::ForegroundRole: {
+            auto level = static_cast<MessageLevel::Enum>(QIdentityProxyModel::data(index, LogModel::LevelRole).toInt());
+            QColor result = colors.foreground.value(level);
 
-                if (result.isValid())
-                    return result;
+            if (result.isValid())
+                return result;
 
-                break;
-            }
-            case Qt::BackgroundRole: {
-                auto level = static_cast<MessageLevel::Enum>(QIdentityProxyModel::data(index, LogModel::LevelRole).toInt());
-                QColor result = colors.background.value(level);
+            break;
+        }
+        case Qt::BackgroundRole: {
+            auto level = static_cast<MessageLevel::Enum>(QIdentityProxyModel::data(index, LogModel::LevelRole).toInt());
+            QColor result = colors.background.value(level);
 
-                if (result.isValid())
-                    return result;
+            if (result.isValid())
+                return result;
 
-                break;
-            }
+            break;
         }
-
-        return QIdentityProxyModel::data(index, role);
     }
 
-    void setFont(QFont font) { m_font = font; }
+    return QIdentityProxyModel::data(index, role);
+}
 
-    QModelIndex find(const QModelIndex& start, const QString& value, bool reverse) const
-    {
-        QModelIndex parentIndex = parent(start);
-        auto compare = [&](int r) -> QModelIndex {
-            QModelIndex idx = index(r, start.column(), parentIndex);
-            if (!idx.isValid() || idx == start) {
-                return QModelIndex();
-            }
-            QVariant v = data(idx, Qt::DisplayRole);
-            QString t = v.toString();
-            if (t.contains(value, Qt::CaseInsensitive))
-                return idx;
+QModelIndex LogFormatProxyModel::find(const QModelIndex& start, const QString& value, bool reverse) const
+{
+    QModelIndex parentIndex = parent(start);
+    auto compare = [&](int r) -> QModelIndex {
+        QModelIndex idx = index(r, start.column(), parentIndex);
+        if (!idx.isValid() || idx == start) {
             return QModelIndex();
-        };
-        if (reverse) {
-            int from = start.row();
-            int to = 0;
-
-            for (int i = 0; i < 2; ++i) {
-                for (int r = from; (r >= to); --r) {
-                    auto idx = compare(r);
-                    if (idx.isValid())
-                        return idx;
-                }
-                // prepare for the next iteration
-                from = rowCount() - 1;
-                to = start.row();
+        }
+        QVariant v = data(idx, Qt::DisplayRole);
+        QString t = v.toString();
+        if (t.contains(value, Qt::CaseInsensitive))
+            return idx;
+        return QModelIndex();
+    };
+    if (reverse) {
+        int from = start.row();
+        int to = 0;
+
+        for (int i = 0; i < 2; ++i) {
+            for (int r = from; (r >= to); --r) {
+                auto idx = compare(r);
+                if (idx.isValid())
+                    return idx;
             }
-        } else {
-            int from = start.row();
-            int to = rowCount(parentIndex);
-
-            for (int i = 0; i < 2; ++i) {
-                for (int r = from; (r < to); ++r) {
-                    auto idx = compare(r);
-                    if (idx.isValid())
-                        return idx;
-                }
-                // prepare for the next iteration
-                from = 0;
-                to = start.row();
+            // prepare for the next iteration
+            from = rowCount() - 1;
+            to = start.row();
+        }
+    } else {
+        int from = start.row();
+        int to = rowCount(parentIndex);
+
+        for (int i = 0; i < 2; ++i) {
+            for (int r = from; (r < to); ++r) {
+                auto idx = compare(r);
+                if (idx.isValid())
+                    return idx;
             }
+            // prepare for the next iteration
+            from = 0;
+            to = start.row();
         }
-        return QModelIndex();
     }
-
-   private:
-    QFont m_font;
-};
+    return QModelIndex();
+}
 
 LogPage::LogPage(InstancePtr instance, QWidget* parent) : QWidget(parent), ui(new Ui::LogPage), m_instance(instance)
 {
@@ -207,10 +200,16 @@ void LogPage::UIToModelState()
 
 void LogPage::setInstanceLaunchTaskChanged(shared_qobject_ptr<LaunchTask> proc, bool initial)
 {
+    if (m_model) {
+        m_model->disconnect(this);
+    }
     m_process = proc;
     if (m_process) {
         m_model = proc->getLogModel();
         m_proxy->setSourceModel(m_model.get());
+        connect(m_model.get(), &LogModel::windowChanged, this, &LogPage::updateWindowButtons);
+        connect(m_model.get(), &LogModel::rowsRemoved, this, &LogPage::updateWindowButtons);
+        connect(m_model.get(), &LogModel::modelReset, this, &LogPage::updateWindowButtons);
         if (initial) {
             modelStateToUI();
         } else {
@@ -220,6 +219,7 @@ void LogPage::setInstanceLaunchTaskChanged(shared_qobject_ptr<LaunchTask> proc,
         m_proxy->setSourceModel(nullptr);
         m_model.reset();
     }
+    updateWindowButtons();
 }
 
 void LogPage::onInstanceLaunchTaskChanged(shared_qobject_ptr<LaunchTask> proc)
@@ -263,6 +263,30 @@ void LogPage::on_btnCopy_clicked()
     GuiUtil::setClipboardText(m_model->toPlainText());
 }
 
+void LogPage::on_btnSaveSession_clicked()
+{
+    if (!m_model || !m_model->sessionLog())
+        return;
+    auto filename = FS::RemoveInvalidFilenameChars(m_instance->name()) + ".log";
+    auto target = QFileDialog::getSaveFileName(this, tr("Save Full Log"), FS::PathCombine(QDir::homePath(), filename),
+                                               tr("Log files") + " (*.log *.txt)");
+    if (target.isEmpty())
+        return;
+
+    // the session can be large, it is decompressed and written out in the background
+    auto model = m_model;
+    auto watcher = new QFutureWatcher<bool>(this);
+    connect(watcher, &QFutureWatcher<bool>::finished, this, [watcher, model, target] {
+        if (watcher->result()) {
+            model->append(MessageLevel::Launcher, QString("Full log saved to: %1").arg(target));
+        } else {
+            model->append(MessageLevel::Error, QString("Saving the full log to %1 failed!").arg(target));
+        }
+        watcher->deleteLater();
+    });
+    watcher->setFuture(m_model->sessionLog()->saveTo(target));
+}
+
 void LogPage::on_btnClear_clicked()
 {
     if (!m_model)
@@ -273,9 +297,29 @@ void LogPage::on_btnClear_clicked()
 
 void LogPage::on_btnBottom_clicked()
 {
+    if (m_model)
+        m_model->showLatest();
     ui->text->scrollToBottom();
 }
 
+void LogPage::on_btnEarlier_clicked()
+{
+    if (m_model)
+        m_model->showEarlier();
+}
+
+void LogPage::on_btnLater_clicked()
+{
+    if (m_model)
+        m_model->showLater();
+}
+
+void LogPage::updateWindowButtons()
+{
+    ui->btnEarlier->setEnabled(m_model && m_model->canShowEarlier());
+    ui->btnLater->setEnabled(m_model && !m_model->isShowingLatest());
+}
+
 void LogPage::on_trackLogCheckbox_clicked(bool checked)
 {
     if (!m_model)
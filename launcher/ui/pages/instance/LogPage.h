@@ -35,6 +35,8 @@
 
 #pragma once
 
+#include <QFont>
+#include <QIdentityProxyModel>
 #include <QWidget>
 
 #include <Application.h>
@@ -46,7 +48,20 @@ namespace Ui {
 class LogPage;
 }
 class QTextCharFormat;
-class LogFormatProxyModel;
+
+/** Adds the console font and the theme's per-level colors to a LogModel. */
+class LogFormatProxyModel : public QIdentityProxyModel {
+   public:
+    LogFormatProxyModel(QObject* parent = nullptr) : QIdentityProxyModel(parent) {}
+    QVariant data(const QModelIndex& index, int role) const override;
+
+    void setFont(QFont font) { m_font = font; }
+
+    QModelIndex find(const QModelIndex& start, const QString& value, bool reverse) const;
+
+   private:
+    QFont m_font;
+};
 
 class LogPage : public QWidget, public BasePage {
     Q_OBJECT
@@ -65,8 +80,12 @@ class LogPage : public QWidget, public BasePage {
    private slots:
     void on_btnPaste_clicked();
     void on_btnCopy_clicked();
+    void on_btnSaveSession_clicked();
     void on_btnClear_clicked();
     void on_btnBottom_clicked();
+    void on_btnEarlier_clicked();
+    void on_btnLater_clicked();
+    void updateWindowButtons();
 
     void on_trackLogCheckbox_clicked(bool checked);
     void on_wrapCheckbox_clicked(bool checked);
@@ -44,14 +44,32 @@
 #include <FileSystem.h>
 #include <GZip.h>
 #include <QShortcut>
+#include "LogPage.h"
 #include "RecursiveFileSystemWatcher.h"
+#include "launch/LogModel.h"
+#include "launch/LogTailer.h"
 
-OtherLogsPage::OtherLogsPage(QString path, IPathMatcher::Ptr fileFilter, QWidget* parent)
-    : QWidget(parent), ui(new Ui::OtherLogsPage), m_path(path), m_fileFilter(fileFilter), m_watcher(new RecursiveFileSystemWatcher(this))
+OtherLogsPage::OtherLogsPage(QString path,
+                             IPathMatcher::Ptr fileFilter,
+                             std::unique_ptr<LogLevelClassifier> levelClassifier,
+                             QWidget* parent)
+    : QWidget(parent)
+    , ui(new Ui::OtherLogsPage)
+    , m_path(path)
+    , m_fileFilter(fileFilter)
+    , m_watcher(new RecursiveFileSystemWatcher(this))
+    , m_model(new LogModel(this))
+    , m_proxy(new LogFormatProxyModel(this))
+    , m_tailer(new LogTailer(this))
+    , m_levelClassifier(std::move(levelClassifier))
 {
     ui->setupUi(this);
     ui->tabWidget->tabBar()->hide();
 
+    m_proxy->setSourceModel(m_model);
+    connect(m_tailer, &LogTailer::linesAppended, this, &OtherLogsPage::onTailedLines);
+    connect(m_tailer, &LogTailer::reset, this, &OtherLogsPage::onTailReset);
+
     m_watcher->setMatcher(fileFilter);
     m_watcher->setRootDir(QDir::current().absoluteFilePath(m_path));
 
@@ -87,23 +105,24 @@ void OtherLogsPage::openedImpl()
 void OtherLogsPage::closedImpl()
 {
     m_watcher->disable();
+    stopFollowing();
 }
 
 void OtherLogsPage::populateSelectLogBox()
 {
-    ui->selectLogBox->clear();
-    ui->selectLogBox->addItems(m_watcher->files());
+    {
+        // a rotated log shows up as a new file, that must not interrupt the one being viewed
+        QSignalBlocker blocker(ui->selectLogBox);
+        ui->selectLogBox->clear();
+        ui->selectLogBox->addItems(m_watcher->files());
+        ui->selectLogBox->setCurrentIndex(m_currentFile.isEmpty() ? -1 : ui->selectLogBox->findText(m_currentFile));
+    }
     if (m_currentFile.isEmpty()) {
         setControlsEnabled(false);
-        ui->selectLogBox->setCurrentIndex(-1);
-    } else {
-        const int index = ui->selectLogBox->findText(m_currentFile);
-        if (index != -1) {
-            ui->selectLogBox->setCurrentIndex(index);
-            setControlsEnabled(true);
-        } else {
-            setControlsEnabled(false);
-        }
+    } else if (ui->selectLogBox->currentIndex() != -1) {
+        setControlsEnabled(true);
+    } else if (!m_tailer->isRunning()) {
+        setControlsEnabled(false);
     }
 }
 
@@ -116,6 +135,7 @@ void OtherLogsPage::on_selectLogBox_currentIndexChanged(const int index)
 
     if (file.isEmpty() || !QFile::exists(FS::PathCombine(m_path, file))) {
         m_currentFile = QString();
+        stopFollowing();
         ui->text->clear();
         setControlsEnabled(false);
     } else {
@@ -127,10 +147,15 @@ void OtherLogsPage::on_selectLogBox_currentIndexChanged(const int index)
 
 void OtherLogsPage::on_btnReload_clicked()
 {
+    stopFollowing();
     if (m_currentFile.isEmpty()) {
         setControlsEnabled(false);
         return;
     }
+    if (ui->followCheckbox->isChecked() && !m_currentFile.endsWith(".gz")) {
+        startFollowing();
+        return;
+    }
     QFile file(FS::PathCombine(m_path, m_currentFile));
     if (!file.open(QFile::ReadOnly)) {
         setControlsEnabled(false);
@@ -160,8 +185,23 @@ void OtherLogsPage::on_btnReload_clicked()
         }
         QString content;
         if (file.fileName().endsWith(".gz")) {
+            // inflate in chunks so a huge archive is rejected without decompressing all of it
+            GZipReader reader(&file);
             QByteArray temp;
-            if (!GZip::unzip(file.readAll(), temp)) {
+            if (reader.open(QIODevice::ReadOnly)) {
+                while (!reader.atEnd() && temp.size() < 50000000ll) {
+                    auto chunk = reader.read(1024 * 1024);
+                    if (chunk.isEmpty()) {
+                        break;
+                    }
+                    temp.append(chunk);
+                }
+            }
+            if (temp.size() >= 50000000ll) {
+                showTooBig();
+                return;
+            }
+            if (!reader.atEnd()) {
                 setPlainText(tr("The file (%1) is not readable.").arg(file.fileName()));
                 return;
             }
@@ -177,6 +217,62 @@ void OtherLogsPage::on_btnReload_clicked()
     }
 }
 
+void OtherLogsPage::on_followCheckbox_clicked(bool)
+{
+    on_btnReload_clicked();
+}
+
+void OtherLogsPage::startFollowing()
+{
+    QString fontFamily = APPLICATION->settings()->get("ConsoleFont").toString();
+    bool conversionOk = false;
+    int fontSize = APPLICATION->settings()->get("ConsoleFontSize").toInt(&conversionOk);
+    if (!conversionOk) {
+        fontSize = 11;
+    }
+    m_proxy->setFont(QFont(fontFamily, fontSize));
+
+    // behave like the live game log: a ring of the newest lines
+    int maxLines = APPLICATION->settings()->get("ConsoleMaxLines").toInt();
+    if (maxLines <= 0) {
+        maxLines = 100000;
+    }
+    m_model->clear();
+    m_model->setMaxLines(maxLines);
+    m_model->setStopOnOverflow(false);
+    ui->text->setMaximumBlockCount(maxLines + 1);
+    ui->text->setModel(m_proxy);
+
+    m_tailer->setFileName(FS::PathCombine(m_path, m_currentFile));
+    m_tailer->start();
+}
+
+void OtherLogsPage::stopFollowing()
+{
+    m_tailer->stop();
+    if (ui->text->model()) {
+        ui->text->setModel(nullptr);
+        ui->text->setMaximumBlockCount(0);
+        m_model->clear();
+    }
+}
+
+void OtherLogsPage::onTailedLines(const QStringList& lines)
+{
+    for (auto line : lines) {
+        auto level = MessageLevel::fromLine(line);
+        if (level == MessageLevel::Unknown && m_levelClassifier) {
+            level = m_levelClassifier->classify(line, level);
+        }
+        m_model->append(level, line);
+    }
+}
+
+void OtherLogsPage::onTailReset()
+{
+    m_model->clear();
+}
+
 void OtherLogsPage::on_btnPaste_clicked()
 {
     GuiUtil::uploadPaste(m_currentFile, ui->text->toPlainText(), this);
@@ -271,6 +367,7 @@ void OtherLogsPage::setControlsEnabled(const bool enabled)
     ui->btnPaste->setEnabled(enabled);
     ui->text->setEnabled(enabled);
     ui->btnClean->setEnabled(enabled);
+    ui->followCheckbox->setEnabled(enabled);
 }
 
 // FIXME: HACK, use LogView instead?
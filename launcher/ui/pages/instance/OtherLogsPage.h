@@ -39,6 +39,7 @@
 
 #include <Application.h>
 #include <pathmatcher/IPathMatcher.h>
+#include "launch/LogLevelClassifier.h"
 #include "ui/pages/BasePage.h"
 
 namespace Ui {
@@ -46,12 +47,18 @@ class OtherLogsPage;
 }
 
 class RecursiveFileSystemWatcher;
+class LogFormatProxyModel;
+class LogModel;
+class LogTailer;
 
 class OtherLogsPage : public QWidget, public BasePage {
     Q_OBJECT
 
    public:
-    explicit OtherLogsPage(QString path, IPathMatcher::Ptr fileFilter, QWidget* parent = 0);
+    explicit OtherLogsPage(QString path,
+                           IPathMatcher::Ptr fileFilter,
+                           std::unique_ptr<LogLevelClassifier> levelClassifier = nullptr,
+                           QWidget* parent = 0);
     ~OtherLogsPage();
 
     QString id() const override { return "logs"; }
@@ -71,6 +78,9 @@ class OtherLogsPage : public QWidget, public BasePage {
     void on_btnCopy_clicked();
     void on_btnDelete_clicked();
     void on_btnClean_clicked();
+    void on_followCheckbox_clicked(bool checked);
+    void onTailedLines(const QStringList& lines);
+    void onTailReset();
 
     void on_findButton_clicked();
     void findActivated();
@@ -79,6 +89,8 @@ class OtherLogsPage : public QWidget, public BasePage {
 
    private:
     void setControlsEnabled(bool enabled);
+    void startFollowing();
+    void stopFollowing();
 
    private:
     Ui::OtherLogsPage* ui;
@@ -86,4 +98,9 @@ class OtherLogsPage : public QWidget, public BasePage {
     QString m_currentFile;
     IPathMatcher::Ptr m_fileFilter;
     RecursiveFileSystemWatcher* m_watcher;
+
+    LogModel* m_model;
+    LogFormatProxyModel* m_proxy;
+    LogTailer* m_tailer;
+    std::unique_ptr<LogLevelClassifier> m_levelClassifier;
 };
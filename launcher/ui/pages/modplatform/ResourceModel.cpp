@@ -8,7 +8,6 @@
 #include <QIcon>
 #include <QList>
 #include <QMessageBox>
-#include <QPixmapCache>
 #include <QUrl>
 #include <algorithm>
 #include <memory>
@@ -22,6 +21,7 @@
 
 #include "modplatform/ModIndex.h"
 
+#include "ui/ImageLoader.h"
 #include "ui/widgets/ProjectItem.h"
 
 namespace ResourceDownload {
@@ -317,9 +317,8 @@ std::optional<ResourceAPI::SortingMethod> ResourceModel::getCurrentSortingMethod
 
 std::optional<QIcon> ResourceModel::getIcon(QModelIndex& index, const QUrl& url)
 {
-    QPixmap pixmap;
-    if (QPixmapCache::find(url.toString(), &pixmap))
-        return { pixmap };
+    if (auto pixmap = ImageLoader::instance()->thumbnail(url.toString()); pixmap.has_value())
+        return { pixmap.value() };
 
     if (!m_current_icon_job) {
         m_current_icon_job.reset(new NetJob("IconJob", APPLICATION->network()));
@@ -338,12 +337,15 @@ std::optional<QIcon> ResourceModel::getIcon(QModelIndex& index, const QUrl& url)
 
     auto full_file_path = cache_entry->getFullPath();
     connect(icon_fetch_action.get(), &Task::succeeded, this, [=] {
-        auto icon = QIcon(full_file_path);
-        QPixmapCache::insert(url.toString(), icon.pixmap(icon.actualSize({ 64, 64 })));
-
-        m_currently_running_icon_actions.remove(url);
+        ImageLoader::instance()->loadThumbnail(url.toString(), full_file_path, { 64, 64 }, this, [=](const QPixmap& pixmap) {
+            m_currently_running_icon_actions.remove(url);
+            if (pixmap.isNull()) {
+                m_failed_icon_actions.insert(url);
+                return;
+            }
 
-        emit dataChanged(index, index, { Qt::DecorationRole });
+            emit dataChanged(index, index, { Qt::DecorationRole });
+        });
     });
     connect(icon_fetch_action.get(), &Task::failed, this, [=] {
         m_currently_running_icon_actions.remove(url);
@@ -21,6 +21,7 @@
 #include <Json.h>
 
 #include "net/ApiDownload.h"
+#include "ui/ImageLoader.h"
 #include "ui/widgets/ProjectItem.h"
 
 namespace Atl {
@@ -201,7 +202,12 @@ void ListModel::requestLogo(QString file, QString url)
     auto fullPath = entry->getFullPath();
     QObject::connect(job, &NetJob::succeeded, this, [this, file, fullPath, job] {
         job->deleteLater();
-        emit logoLoaded(file, QIcon(fullPath));
+        ImageLoader::instance()->loadThumbnail(fullPath, fullPath, { 64, 64 }, this, [this, file](const QPixmap& pixmap) {
+            if (pixmap.isNull())
+                logoFailed(file);
+            else
+                logoLoaded(file, QIcon(pixmap));
+        });
         if (waitingCallbacks.contains(file)) {
             waitingCallbacks.value(file)(fullPath);
         }
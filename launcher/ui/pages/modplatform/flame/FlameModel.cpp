@@ -4,6 +4,7 @@
 #include "modplatform/ModIndex.h"
 #include "modplatform/ResourceAPI.h"
 #include "modplatform/flame/FlameAPI.h"
+#include "ui/ImageLoader.h"
 #include "ui/widgets/ProjectItem.h"
 
 #include "net/ApiDownload.h"
@@ -117,7 +118,12 @@ void ListModel::requestLogo(QString logo, QString url)
     auto fullPath = entry->getFullPath();
     QObject::connect(job, &NetJob::succeeded, this, [this, logo, fullPath, job] {
         job->deleteLater();
-        emit logoLoaded(logo, QIcon(fullPath));
+        ImageLoader::instance()->loadThumbnail(fullPath, fullPath, { 64, 64 }, this, [this, logo](const QPixmap& pixmap) {
+            if (pixmap.isNull())
+                logoFailed(logo);
+            else
+                logoLoaded(logo, QIcon(pixmap));
+        });
         if (waitingCallbacks.contains(logo)) {
             waitingCallbacks.value(logo)(fullPath);
         }
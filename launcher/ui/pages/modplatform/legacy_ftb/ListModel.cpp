@@ -41,6 +41,7 @@
 
 #include <Version.h>
 #include "StringUtils.h"
+#include "ui/ImageLoader.h"
 #include "ui/widgets/ProjectItem.h"
 
 #include <QLabel>
@@ -270,7 +271,12 @@ void ListModel::requestLogo(QString file)
     auto fullPath = entry->getFullPath();
     QObject::connect(job, &NetJob::finished, this, [this, file, fullPath, job] {
         job->deleteLater();
-        emit logoLoaded(file, QIcon(fullPath));
+        ImageLoader::instance()->loadThumbnail(fullPath, fullPath, { 64, 64 }, this, [this, file](const QPixmap& pixmap) {
+            if (pixmap.isNull())
+                logoFailed(file);
+            else
+                logoLoaded(file, QIcon(pixmap));
+        });
         if (waitingCallbacks.contains(file)) {
             waitingCallbacks.value(file)(fullPath);
         }
@@ -40,6 +40,7 @@
 #include "Json.h"
 #include "modplatform/modrinth/ModrinthAPI.h"
 #include "net/NetJob.h"
+#include "ui/ImageLoader.h"
 #include "ui/widgets/ProjectItem.h"
 
 #include "net/ApiDownload.h"
@@ -257,7 +258,12 @@ void ModpackListModel::requestLogo(QString logo, QString url)
     auto fullPath = entry->getFullPath();
     QObject::connect(job, &NetJob::succeeded, this, [this, logo, fullPath, job] {
         job->deleteLater();
-        emit logoLoaded(logo, QIcon(fullPath));
+        ImageLoader::instance()->loadThumbnail(fullPath, fullPath, { 64, 64 }, this, [this, logo](const QPixmap& pixmap) {
+            if (pixmap.isNull())
+                logoFailed(logo);
+            else
+                logoLoaded(logo, QIcon(pixmap));
+        });
         if (waitingCallbacks.contains(logo)) {
             waitingCallbacks.value(logo)(fullPath);
         }
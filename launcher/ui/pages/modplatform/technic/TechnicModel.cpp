@@ -39,6 +39,7 @@
 #include "Json.h"
 
 #include "net/ApiDownload.h"
+#include "ui/ImageLoader.h"
 #include "ui/widgets/ProjectItem.h"
 
 #include <QFileInfo>
@@ -271,10 +272,10 @@ void Technic::ListModel::searchRequestFailed()
     }
 }
 
-void Technic::ListModel::logoLoaded(QString logo, QString out)
+void Technic::ListModel::logoLoaded(QString logo, QIcon out)
 {
     m_loadingLogos.removeAll(logo);
-    m_logoMap.insert(logo, QIcon(out));
+    m_logoMap.insert(logo, out);
     for (int i = 0; i < modpacks.size(); i++) {
         if (modpacks[i].logoName == logo) {
             emit dataChanged(createIndex(i, 0), createIndex(i, 0), { Qt::DecorationRole });
@@ -303,7 +304,12 @@ void Technic::ListModel::requestLogo(QString logo, QString url)
 
     QObject::connect(job, &NetJob::succeeded, this, [this, logo, fullPath, job] {
         job->deleteLater();
-        logoLoaded(logo, fullPath);
+        ImageLoader::instance()->loadThumbnail(fullPath, fullPath, { 64, 64 }, this, [this, logo](const QPixmap& pixmap) {
+            if (pixmap.isNull())
+                logoFailed(logo);
+            else
+                logoLoaded(logo, QIcon(pixmap));
+        });
     });
 
     QObject::connect(job, &NetJob::failed, this, [this, logo, job] {
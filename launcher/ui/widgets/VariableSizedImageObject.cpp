@@ -29,6 +29,8 @@
 #include "net/ApiDownload.h"
 #include "net/NetJob.h"
 
+#include "ui/ImageLoader.h"
+
 enum FormatProperties { ImageData = QTextFormat::UserProperty + 1 };
 
 QSizeF VariableSizedImageObject::intrinsicSize(QTextDocument* doc, int posInDocument, const QTextFormat& format)
@@ -165,8 +167,13 @@ void VariableSizedImageObject::loadImage(QTextDocument* doc, std::shared_ptr<Ima
         if (!m_fetching_images.contains(source_url))
             return;
 
-        QImage image(full_entry_path);
-        loadImage(image);
+        ImageLoader::instance()->loadImage(full_entry_path, this, [this, source_url, loadImage](const QImage& image) {
+            // The page may have been flushed while decoding, too.
+            if (!m_fetching_images.contains(source_url))
+                return;
+
+            loadImage(image);
+        });
     });
     connect(job, &NetJob::failed, this, [this, full_entry_path, source_url, loadImage](QString reason) {
         qWarning() << "Failed resource at:" << full_entry_path << " because:" << reason;
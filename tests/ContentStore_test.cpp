@@ -0,0 +1,157 @@
+#include <QCryptographicHash>
+#include <QDir>
+#include <QFile>
+#include <QTemporaryDir>
+#include <QTest>
+
+#include <ContentStore.h>
+#include <FileSystem.h>
+#include <minecraft/mod/Resource.h>
+
+class ContentStoreTest : public QObject {
+    Q_OBJECT
+
+    QTemporaryDir tempDir;
+    QString oldCwd;
+
+    static bool writeFile(const QString& path, const QByteArray& data)
+    {
+        QFile file(path);
+        return FS::ensureFilePathExists(path) && file.open(QFile::WriteOnly) && file.write(data) == data.size();
+    }
+
+    static QByteArray readFile(const QString& path)
+    {
+        QFile file(path);
+        if (!file.open(QFile::ReadOnly))
+            return {};
+        return file.readAll();
+    }
+
+   private slots:
+    void initTestCase()
+    {
+        QVERIFY(tempDir.isValid());
+        // the store lives in the data directory, which is the working directory
+        oldCwd = QDir::currentPath();
+        QDir::setCurrent(tempDir.path());
+    }
+    void cleanupTestCase() { QDir::setCurrent(oldCwd); }
+
+    void test_path()
+    {
+        const QByteArray data = "some mod";
+        const auto sha1 = QCryptographicHash::hash(data, QCryptographicHash::Sha1);
+
+        QVERIFY(ContentStore::path(QCryptographicHash::Sha1, sha1).endsWith("sha1/" + sha1.toHex().left(2) + "/" + sha1.toHex()));
+        // hashes that are too weak or of the wrong length can't address the store
+        QVERIFY(ContentStore::path(QCryptographicHash::Md5, QCryptographicHash::hash(data, QCryptographicHash::Md5)).isEmpty());
+        QVERIFY(ContentStore::path(QCryptographicHash::Sha512, sha1).isEmpty());
+    }
+
+    void test_storable()
+    {
+        QVERIFY(ContentStore::isStorable(FS::PathCombine(tempDir.path(), "instances", "a", "mods", "mod.jar")));
+        QVERIFY(ContentStore::isStorable(FS::PathCombine(tempDir.path(), "instances", "a", "shaderpacks", "shaders.zip")));
+        // configs are edited in place, so they never share their data
+        QVERIFY(!ContentStore::isStorable(FS::PathCombine(tempDir.path(), "instances", "a", "config", "mod.toml")));
+    }
+
+    void test_addAndMaterialize()
+    {
+        if (!FS::canCloneOnFS(tempDir.path()) && !FS::canLinkOnFS(tempDir.path()))
+            QSKIP("The filesystem can neither clone nor link files");
+
+        const QByteArray data = "the contents of a mod";
+        const auto sha512 = QCryptographicHash::hash(data, QCryptographicHash::Sha512);
+        const QString first = FS::PathCombine(tempDir.path(), "instances", "a", "mods", "mod.jar");
+        const QString second = FS::PathCombine(tempDir.path(), "instances", "b", "mods", "mod.jar");
+        const QString stored = ContentStore::path(QCryptographicHash::Sha512, sha512);
+
+        QVERIFY(!ContentStore::materialize(QCryptographicHash::Sha512, sha512, second));
+
+        QVERIFY(writeFile(first, data));
+        QVERIFY(ContentStore::add(QCryptographicHash::Sha512, sha512, first));
+        QVERIFY(QFile::exists(stored));
+
+        // an existing file at the target is replaced
+        QVERIFY(writeFile(second, "an older version"));
+        QVERIFY(ContentStore::materialize(QCryptographicHash::Sha512, sha512, second));
+        QCOMPARE(readFile(first), data);
+        QCOMPARE(readFile(second), data);
+
+        // a hard linked file can't be written to, and the store's own link isn't reported
+        if (FS::hardLinkCount(second) > 1) {
+            QFile file(second);
+            QVERIFY(!file.open(QFile::WriteOnly | QFile::Append));
+            QCOMPARE(ContentStore::linkCount(second), FS::hardLinkCount(second) - 1);
+        }
+
+        // still in use, so nothing is collected
+        QCOMPARE(ContentStore::collectGarbage().removedFiles, 0);
+
+        QVERIFY(FS::deletePath(first));
+        QVERIFY(FS::deletePath(second));
+        // reflinked entries are kept for a while after their last use
+        if (!(QFile::permissions(stored) & QFileDevice::WriteOwner)) {
+            auto result = ContentStore::collectGarbage();
+            QCOMPARE(result.removedFiles, 1);
+            QCOMPARE(result.freedBytes, qint64(data.size()));
+            QVERIFY(!QFile::exists(stored));
+        }
+    }
+
+    void test_destroyMaterialized()
+    {
+        if (!FS::canCloneOnFS(tempDir.path()) && !FS::canLinkOnFS(tempDir.path()))
+            QSKIP("The filesystem can neither clone nor link files");
+
+        const QByteArray data = "a mod that gets deleted";
+        const auto sha1 = QCryptographicHash::hash(data, QCryptographicHash::Sha1);
+        const QString first = FS::PathCombine(tempDir.path(), "instances", "d", "mods", "mod.jar");
+        const QString second = FS::PathCombine(tempDir.path(), "instances", "e", "mods", "mod.jar");
+        const QString stored = ContentStore::path(QCryptographicHash::Sha1, sha1);
+
+        QVERIFY(writeFile(first, data));
+        QVERIFY(ContentStore::add(QCryptographicHash::Sha1, sha1, first));
+        QVERIFY(ContentStore::materialize(QCryptographicHash::Sha1, sha1, second));
+        const bool readOnly = !(QFile::permissions(stored) & QFileDevice::WriteOwner);
+
+        // placed files are deleted like any other, without taking the store entry or the other instances' files along
+        Resource resource(second);
+        QVERIFY(resource.destroy(false));
+        QVERIFY(!QFile::exists(second));
+        QCOMPARE(readFile(first), data);
+        QCOMPARE(readFile(stored), data);
+        QCOMPARE(!(QFile::permissions(stored) & QFileDevice::WriteOwner), readOnly);
+
+        // and so is the instance folder holding one
+        QVERIFY(FS::deletePath(FS::PathCombine(tempDir.path(), "instances", "d")));
+        QVERIFY(!QFile::exists(first));
+        QVERIFY(QFile::exists(stored));
+    }
+
+    void test_damagedEntry()
+    {
+        if (!FS::canCloneOnFS(tempDir.path()) && !FS::canLinkOnFS(tempDir.path()))
+            QSKIP("The filesystem can neither clone nor link files");
+
+        const QByteArray data = "another mod";
+        const auto sha1 = QCryptographicHash::hash(data, QCryptographicHash::Sha1);
+        const QString first = FS::PathCombine(tempDir.path(), "instances", "c", "mods", "other.jar");
+        const QString stored = ContentStore::path(QCryptographicHash::Sha1, sha1);
+
+        QVERIFY(writeFile(first, data));
+        QVERIFY(ContentStore::add(QCryptographicHash::Sha1, sha1, first));
+        QVERIFY(FS::deletePath(first));
+
+        QFile::setPermissions(stored, QFile::permissions(stored) | QFileDevice::WriteOwner);
+        QVERIFY(writeFile(stored, "tampered"));
+        QVERIFY(!ContentStore::materialize(QCryptographicHash::Sha1, sha1, first));
+        QVERIFY(!QFile::exists(stored));
+    }
+};
+
+QTEST_GUILESS_MAIN(ContentStoreTest)
+
+#include "ContentStore_test.moc"
@@ -1,6 +1,7 @@
 #include <QTest>
 
 #include <GZip.h>
+#include <QBuffer>
 #include <random>
 
 void fib(int& prev, int& cur)
@@ -45,6 +46,63 @@ class GZipTest : public QObject {
             fib(prev, cur);
         } while (cur < size);
     }
+
+    void test_Streaming()
+    {
+        static const int size = 4 * 1024 * 1024;
+        QByteArray input;
+        std::default_random_engine eng((std::random_device())());
+        std::uniform_int_distribution<uint16_t> idis(0, std::numeric_limits<uint8_t>::max());
+        for (int i = 0; i < size; i++) {
+            // keep some redundancy so the compressed side spans several buffers in both directions
+            input.append(i % 3 ? 'a' : static_cast<char>(idis(eng)));
+        }
+
+        // writer output must be readable by the in-memory API
+        QByteArray compressed;
+        {
+            QBuffer sink(&compressed);
+            QVERIFY(sink.open(QIODevice::WriteOnly));
+            GZipWriter writer(&sink);
+            QVERIFY(writer.open(QIODevice::WriteOnly));
+            for (int offset = 0; offset < input.size(); offset += 12345) {
+                auto part = input.mid(offset, 12345);
+                QCOMPARE(writer.write(part), part.size());
+            }
+            QVERIFY(writer.finish());
+        }
+        QByteArray decompressed;
+        QVERIFY(GZip::unzip(compressed, decompressed));
+        QCOMPARE(decompressed, input);
+
+        // reader must understand the in-memory API output
+        compressed.clear();
+        QVERIFY(GZip::zip(input, compressed));
+        QBuffer source(&compressed);
+        QVERIFY(source.open(QIODevice::ReadOnly));
+        GZipReader reader(&source);
+        QVERIFY(reader.open(QIODevice::ReadOnly));
+        decompressed.clear();
+        while (!reader.atEnd()) {
+            auto chunk = reader.read(4096);
+            QVERIFY(!chunk.isEmpty());
+            decompressed.append(chunk);
+        }
+        QCOMPARE(decompressed, input);
+    }
+
+    void test_StreamingTruncated()
+    {
+        QByteArray compressed;
+        QVERIFY(GZip::zip(QByteArray(100000, 'x'), compressed));
+        compressed.chop(10);
+        QBuffer source(&compressed);
+        QVERIFY(source.open(QIODevice::ReadOnly));
+        GZipReader reader(&source);
+        QVERIFY(reader.open(QIODevice::ReadOnly));
+        reader.readAll();
+        QVERIFY(!reader.atEnd());
+    }
 };
 
 QTEST_GUILESS_MAIN(GZipTest)
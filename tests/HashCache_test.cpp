@@ -0,0 +1,62 @@
+#include <QDateTime>
+#include <QFile>
+#include <QTemporaryDir>
+#include <QTest>
+
+#include <modplatform/helpers/HashUtils.h>
+
+class HashCacheTest : public QObject {
+    Q_OBJECT
+
+    static bool writeFile(const QString& path, const QByteArray& data, const QDateTime& modified)
+    {
+        QFile file(path);
+        if (!file.open(QFile::WriteOnly) || file.write(data) != data.size())
+            return false;
+        return file.setFileTime(modified, QFileDevice::FileModificationTime);
+    }
+
+   private slots:
+    void test_reuse()
+    {
+        QTemporaryDir dir;
+        QVERIFY(dir.isValid());
+        auto jar = dir.filePath("mod.jar");
+        auto index = dir.filePath("cache/hashes.json");
+        auto modified = QDateTime::fromSecsSinceEpoch(1700000000);
+
+        QVERIFY(writeFile(jar, "first", modified));
+        auto first = Hashing::hash(QByteArray("first"), Hashing::Algorithm::Sha512);
+        {
+            Hashing::HashCache cache(index);
+            QCOMPARE(cache.hash(jar, Hashing::Algorithm::Sha512), first);
+            cache.save();
+        }
+
+        // same size and modification time, so the file is trusted to be unchanged
+        QVERIFY(writeFile(jar, "other", modified));
+        {
+            Hashing::HashCache cache(index);
+            QCOMPARE(cache.hash(jar, Hashing::Algorithm::Sha512), first);
+        }
+
+        // the algorithm is part of the key
+        Hashing::HashCache cache(index);
+        QCOMPARE(cache.hash(jar, Hashing::Algorithm::Sha1), Hashing::hash(QByteArray("other"), Hashing::Algorithm::Sha1));
+
+        QVERIFY(writeFile(jar, "other", modified.addSecs(60)));
+        QCOMPARE(cache.hash(jar, Hashing::Algorithm::Sha512), Hashing::hash(QByteArray("other"), Hashing::Algorithm::Sha512));
+    }
+
+    void test_missing()
+    {
+        QTemporaryDir dir;
+        QVERIFY(dir.isValid());
+        Hashing::HashCache cache(dir.filePath("hashes.json"));
+        QVERIFY(cache.hash(dir.filePath("missing.jar"), Hashing::Algorithm::Sha512).isEmpty());
+    }
+};
+
+QTEST_GUILESS_MAIN(HashCacheTest)
+
+#include "HashCache_test.moc"
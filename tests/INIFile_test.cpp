@@ -1,6 +1,7 @@
 #include <QTest>
 
 #include <settings/INIFile.h>
+#include <QDir>
 #include <QList>
 #include <QSettings>
 #include <QTemporaryFile>
@@ -190,6 +191,108 @@ PreLaunchCommand=)";
         FS::deletePath(fileName);
 #endif
     }
+
+    void test_QSettingsCompatibility_data()
+    {
+        QTest::addColumn<QByteArray>("content");
+
+        QTest::newRow("plain") << QByteArray("[General]\nConfigVersion=1.2\nname=Minecraft Vanilla\niconKey=default\n");
+        QTest::newRow("quoted") << QByteArray("[General]\nConfigVersion=1.2\nJvmArgs=\"-Xmx2G -Dfoo=bar;baz\"\nspaces=\"  padded  \"\n");
+        QTest::newRow("escapes") << QByteArray("[General]\nConfigVersion=1.2\nnotes=one\\ntwo\\t\\\"three\\\" \\x263a \\101\\\\\n");
+        QTest::newRow("lists") << QByteArray("[General]\nConfigVersion=1.2\nlist=a, b , \"c, d\"\nnumbers=1,2,3\nempty=@Invalid()\n");
+        QTest::newRow("comments") << QByteArray("; comment\n[General]\nConfigVersion=1.2\na=1 ; trailing\n\n  ;indented\nb = 2 \n");
+        QTest::newRow("sections") << QByteArray("[General]\nConfigVersion=1.2\n\n[Section]\nb=2\n\n[%General]\nc=3\n");
+        QTest::newRow("keys") << QByteArray("[General]\nConfigVersion=1.2\nspace%20key=1\nslash\\key=2\n%U263Aunicode=3\n");
+        QTest::newRow("variants") << QByteArray("[General]\nConfigVersion=1.2\ngeometry=@ByteArray(AdnQywADAAA)\nat=@@home\n");
+        QTest::newRow("line breaks") << QByteArray("[General]\r\nConfigVersion=1.2\r\na=1\r\nb=\"x\r\ny\"\r\nc=con\\\r\ntinued\r\n");
+#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+        // Qt 5 reads INI files as Latin-1 unless a codec is set
+        QTest::newRow("utf-8") << QByteArray(
+            "\xef\xbb\xbf[General]\nConfigVersion=1.2\nname=\xd0\xa2\xd0\xb5\xd1\x81\xd1\x82 \xe2\x9c\x93\n");
+#endif
+    }
+
+    void test_QSettingsCompatibility()
+    {
+        QFETCH(QByteArray, content);
+        QString fileName = "test_QSettingsCompatibility.ini";
+        QString savedFileName = "test_QSettingsCompatibility_saved.ini";
+        FS::write(fileName, content);
+
+        QSettings settings{ fileName, QSettings::Format::IniFormat };
+        settings.setFallbacksEnabled(false);
+        QCOMPARE(settings.status(), QSettings::Status::NoError);
+
+        INIFile f1;
+        QVERIFY(f1.loadFile(fileName));
+        QCOMPARE(f1.size(), settings.allKeys().size());
+        for (auto key : settings.allKeys())
+            QCOMPARE(f1.get(key, "NOT SET"), settings.value(key));
+
+        // and what we write has to be read the same way by QSettings
+        QVERIFY(f1.saveFile(savedFileName));
+        QSettings saved{ savedFileName, QSettings::Format::IniFormat };
+        saved.setFallbacksEnabled(false);
+        QCOMPARE(saved.status(), QSettings::Status::NoError);
+        for (auto key : settings.allKeys())
+            QCOMPARE(saved.value(key), settings.value(key));
+
+        FS::deletePath(fileName);
+        FS::deletePath(savedFileName);
+    }
+
+    void benchmark_load_data()
+    {
+        QTest::addColumn<bool>("useQSettings");
+        QTest::newRow("QSettings") << true;
+        QTest::newRow("INIFile") << false;
+    }
+
+    void benchmark_load()
+    {
+        QFETCH(bool, useQSettings);
+
+        // enough files that QSettings can't serve them from its cache of parsed files
+        QDir dir("benchmark_load");
+        dir.mkpath(".");
+        QStringList fileNames;
+        for (int i = 0; i < 200; i++) {
+            INIFile f;
+            f.set("InstanceType", "OneSix");
+            f.set("name", QString("Instance %1").arg(i));
+            f.set("iconKey", "default");
+            f.set("notes", "Some notes\nwith a second line, and \"quotes\"");
+            f.set("JvmArgs", "-XX:+UseG1GC -Dfml.ignoreInvalidMinecraftCertificates=true");
+            f.set("PreLaunchCommand", "\"$INST_JAVA\" -jar packwiz-installer-bootstrap.jar link");
+            f.set("lastLaunchTime", QString::number(1700000000000 + i));
+            f.set("totalTimePlayed", QString::number(i * 60));
+            for (int j = 0; j < 50; j++)
+                f.set(QString("Setting%1").arg(j), j % 2 ? QString("false") : QString("value %1").arg(j));
+            fileNames.append(dir.absoluteFilePath(QString("instance%1.cfg").arg(i)));
+            f.saveFile(fileNames.last());
+        }
+
+        if (useQSettings) {
+            QBENCHMARK
+            {
+                for (auto& fileName : fileNames) {
+                    QSettings settings{ fileName, QSettings::Format::IniFormat };
+                    settings.setFallbacksEnabled(false);
+                    for (auto key : settings.allKeys())
+                        settings.value(key);
+                }
+            }
+        } else {
+            QBENCHMARK
+            {
+                for (auto& fileName : fileNames) {
+                    INIFile f;
+                    f.loadFile(fileName);
+                }
+            }
+        }
+        dir.removeRecursively();
+    }
 };
 
 QTEST_GUILESS_MAIN(IniFileTest)
@@ -33,6 +33,23 @@ class IndexTest : public QObject {
         windex.merge(std::shared_ptr<Meta::Index>(new Meta::Index({ std::make_shared<Meta::VersionList>("list6") })));
         QCOMPARE(windex.lists().size(), 6);
     }
+
+    void test_groupVersions()
+    {
+        // several instances on the same versions
+        auto wanted = Meta::Index::groupVersions({ { "net.minecraft", "1.20.1" },
+                                                   { "net.fabricmc.fabric-loader", "0.15.0" },
+                                                   { "net.minecraft", "1.20.1" },
+                                                   { "net.minecraft", "1.19.4" },
+                                                   { "net.fabricmc.fabric-loader", "0.15.0" },
+                                                   { "net.minecraftforge", "" } });
+        QCOMPARE(wanted.size(), 3);
+        QCOMPARE(wanted.value("net.minecraft"), QSet<QString>({ "1.20.1", "1.19.4" }));
+        QCOMPARE(wanted.value("net.fabricmc.fabric-loader"), QSet<QString>({ "0.15.0" }));
+        // only the version list is loaded
+        QVERIFY(wanted.contains("net.minecraftforge"));
+        QVERIFY(wanted.value("net.minecraftforge").isEmpty());
+    }
 };
 
 QTEST_GUILESS_MAIN(IndexTest)
@@ -132,7 +132,7 @@ class LibraryTest : public QObject {
     {
         RuntimeContext r = dummyContext();
         Library test("test.package:testname:testversion");
-        test.m_nativeClassifiers["linux"] = "linux";
+        test.setNativeClassifiers({ { "linux", "linux" } });
         QCOMPARE(test.isNative(), true);
         test.setRepositoryURL("file://foo/bar");
         {
@@ -154,9 +154,7 @@ class LibraryTest : public QObject {
     {
         RuntimeContext r = dummyContext();
         Library test("test.package:testname:testversion");
-        test.m_nativeClassifiers["linux"] = "linux-${arch}";
-        test.m_nativeClassifiers["osx"] = "osx-${arch}";
-        test.m_nativeClassifiers["windows"] = "windows-${arch}";
+        test.setNativeClassifiers({ { "linux", "linux-${arch}" }, { "osx", "osx-${arch}" }, { "windows", "windows-${arch}" } });
         QCOMPARE(test.isNative(), true);
         test.setRepositoryURL("file://foo/bar");
         {
@@ -208,7 +206,7 @@ class LibraryTest : public QObject {
     {
         RuntimeContext r = dummyContext();
         Library test("test.package:testname:testversion");
-        test.m_nativeClassifiers["linux"] = "linux-${arch}";
+        test.setNativeClassifiers({ { "linux", "linux-${arch}" } });
         test.setHint("local");
         QCOMPARE(test.isNative(), true);
         test.setRepositoryURL("file://foo/bar");
@@ -226,6 +224,31 @@ class LibraryTest : public QObject {
                      { QFileInfo(QFINDTESTDATA("testdata/Library") + "/testname-testversion-linux-64.jar").absoluteFilePath() });
         }
     }
+    void test_rules_runtime_context()
+    {
+        RuntimeContext r = dummyContext("osx");
+        Library test("test.package:testname:testversion");
+        test.setNativeClassifiers({ { "osx", "natives-osx" }, { "linux", "natives-linux" } });
+        test.setRules({ OsRule::create(Allow, "osx", QString()) });
+        QCOMPARE(test.isActive(r), true);
+        QCOMPARE(test.getCompatibleNative(r), QString("natives-osx"));
+        // the evaluation has to follow the runtime context
+        r.system = "linux";
+        QCOMPARE(test.isActive(r), false);
+        QCOMPARE(test.getCompatibleNative(r), QString("natives-linux"));
+        r.system = "windows";
+        QCOMPARE(test.isActive(r), false);
+        QCOMPARE(test.getCompatibleNative(r), QString());
+        r.system = "osx";
+        QCOMPARE(test.isActive(r), true);
+        // and so do the rules
+        test.setRules({ OsRule::create(Disallow, "osx", QString()) });
+        QCOMPARE(test.isActive(r), false);
+        // and so do the native classifiers
+        QCOMPARE(test.getCompatibleNative(r), QString("natives-osx"));
+        test.setNativeClassifiers({ { "osx", "natives-macos" } });
+        QCOMPARE(test.getCompatibleNative(r), QString("natives-macos"));
+    }
     void test_onenine()
     {
         RuntimeContext r = dummyContext("osx");
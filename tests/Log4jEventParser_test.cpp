@@ -0,0 +1,65 @@
+#include <QTest>
+
+#include <launch/Log4jEventParser.h>
+
+class Log4jEventParserTest : public QObject {
+    Q_OBJECT
+
+   private slots:
+    void test_legacyLayout()
+    {
+        Log4jEventParser parser;
+        QStringList lines = {
+            "Plain line before",
+            R"(<log4j:Event logger="net.minecraft.client.Minecraft" timestamp="1700000000000" level="WARN" thread="Render thread">)",
+            "  <log4j:Message><![CDATA[Missing sound for event: <none> & more]]></log4j:Message>",
+        };
+        auto items = parser.feed(lines);
+        QCOMPARE(items.size(), 1);
+        QCOMPARE(std::get<QString>(items[0]), QString("Plain line before"));
+        QVERIFY(parser.isBuffering());
+
+        items = parser.feed({ "</log4j:Event>", "", "Plain line after" });
+        QCOMPARE(items.size(), 3);
+        auto event = std::get<LogEvent>(items[0]);
+        QCOMPARE(event.level, MessageLevel::Warning);
+        QCOMPARE(event.logger, QString("net.minecraft.client.Minecraft"));
+        QCOMPARE(event.thread, QString("Render thread"));
+        QCOMPARE(event.timestamp, QDateTime::fromMSecsSinceEpoch(1700000000000));
+        QCOMPARE(event.message, QString("Missing sound for event: <none> & more"));
+        QCOMPARE(std::get<QString>(items[2]), QString("Plain line after"));
+        QVERIFY(!parser.isBuffering());
+    }
+
+    void test_log4j2Layout()
+    {
+        Log4jEventParser parser;
+        auto items = parser.feed({
+            R"(<Event xmlns="http://logging.apache.org/log4j/2.0/events" timeMillis="1700000000000" thread="main" level="ERROR" loggerName="Foo">)",
+            "  <Message>Something broke</Message>",
+            R"(  <Thrown name="java.lang.IllegalStateException" message="bad state"/>)",
+            "</Event>",
+        });
+        QCOMPARE(items.size(), 1);
+        auto event = std::get<LogEvent>(items[0]);
+        QCOMPARE(event.level, MessageLevel::Error);
+        QCOMPARE(event.logger, QString("Foo"));
+        QCOMPARE(event.message, QString("Something broke"));
+        QCOMPARE(event.throwable, QString("java.lang.IllegalStateException: bad state"));
+    }
+
+    void test_brokenEventIsPassedThrough()
+    {
+        Log4jEventParser parser;
+        QStringList lines = { R"(<log4j:Event logger="a" level="INFO" thread="main">)", "<log4j:Message>unterminated", "</log4j:Event>" };
+        auto items = parser.feed(lines);
+        QCOMPARE(items.size(), 3);
+        for (int i = 0; i < lines.size(); i++) {
+            QCOMPARE(std::get<QString>(items[i]), lines[i]);
+        }
+    }
+};
+
+QTEST_GUILESS_MAIN(Log4jEventParserTest)
+
+#include "Log4jEventParser_test.moc"
@@ -0,0 +1,144 @@
+#include <QFile>
+#include <QTest>
+
+#include <launch/LogLevelClassifier.h>
+
+namespace {
+// the classifier MinecraftInstance used to build for every single line, kept as the reference
+MessageLevel::Enum legacyGuessLevel(const QString& line, MessageLevel::Enum level)
+{
+    QRegularExpression re("\\[(?<timestamp>[0-9:]+)\\] \\[[^/]+/(?<level>[^\\]]+)\\]");
+    auto match = re.match(line);
+    if (match.hasMatch()) {
+        QString levelStr = match.captured("level");
+        if (levelStr == "INFO")
+            level = MessageLevel::Message;
+        if (levelStr == "WARN")
+            level = MessageLevel::Warning;
+        if (levelStr == "ERROR")
+            level = MessageLevel::Error;
+        if (levelStr == "FATAL")
+            level = MessageLevel::Fatal;
+        if (levelStr == "TRACE" || levelStr == "DEBUG")
+            level = MessageLevel::Debug;
+    } else {
+        if (line.contains("[INFO]") || line.contains("[CONFIG]") || line.contains("[FINE]") || line.contains("[FINER]") ||
+            line.contains("[FINEST]"))
+            level = MessageLevel::Message;
+        if (line.contains("[SEVERE]") || line.contains("[STDERR]"))
+            level = MessageLevel::Error;
+        if (line.contains("[WARNING]"))
+            level = MessageLevel::Warning;
+        if (line.contains("[DEBUG]"))
+            level = MessageLevel::Debug;
+    }
+    if (line.contains("overwriting existing"))
+        return MessageLevel::Fatal;
+    static const QString javaSymbol = "([a-zA-Z_$][a-zA-Z\\d_$]*\\.)+[a-zA-Z_$][a-zA-Z\\d_$]*";
+    if (line.contains("Exception in thread") || line.contains(QRegularExpression("\\s+at " + javaSymbol)) ||
+        line.contains(QRegularExpression("Caused by: " + javaSymbol)) ||
+        line.contains(QRegularExpression("([a-zA-Z_$][a-zA-Z\\d_$]*\\.)+[a-zA-Z_$]?[a-zA-Z\\d_$]*(Exception|Error|Throwable)")) ||
+        line.contains(QRegularExpression("... \\d+ more$")))
+        return MessageLevel::Error;
+    return level;
+}
+
+LogLevelClassifier minecraftClassifier()
+{
+    LogLevelClassifier classifier;
+    classifier.addMinecraftRules();
+    return classifier;
+}
+
+// the legacy classifier did not know about these headers
+bool isModLauncherLine(const QString& line)
+{
+    static const QRegularExpression header("^\\[[0-9]{2}[A-Za-z]{3}[0-9]{4} ");
+    return header.match(line).hasMatch();
+}
+}  // namespace
+
+class LogLevelClassifierTest : public QObject {
+    Q_OBJECT
+
+    QStringList m_lines;
+
+   private slots:
+    void initTestCase()
+    {
+        QFile log(QFINDTESTDATA("testdata/LogLevelClassifier/latest.log"));
+        QVERIFY(log.open(QIODevice::ReadOnly));
+        m_lines = QString::fromUtf8(log.readAll()).split('\n');
+        QVERIFY(m_lines.size() > 40);
+    }
+
+    void test_matchesLegacy()
+    {
+        auto classifier = minecraftClassifier();
+        for (auto& line : m_lines) {
+            if (isModLauncherLine(line)) {
+                continue;
+            }
+            for (auto level : { MessageLevel::StdOut, MessageLevel::StdErr, MessageLevel::Unknown }) {
+                QCOMPARE(classifier.classify(line, level), legacyGuessLevel(line, level));
+            }
+        }
+    }
+
+    void test_modLauncherHeader()
+    {
+        LogLevelClassifier classifier;
+        classifier.addLog4jRules();
+        auto line = QStringLiteral("[22Jan2024 12:34:57.012] [main/WARN] [net.neoforged.fml.loading/SCAN]: Mod file is missing");
+        QCOMPARE(classifier.classify(line, MessageLevel::StdOut), MessageLevel::StdOut);
+        classifier.addModLauncherRules();
+        QCOMPARE(classifier.classify(line, MessageLevel::StdOut), MessageLevel::Warning);
+    }
+
+    void test_modLauncherLines()
+    {
+        auto classifier = minecraftClassifier();
+        QList<MessageLevel::Enum> levels;
+        for (auto& line : m_lines) {
+            if (isModLauncherLine(line)) {
+                levels.append(classifier.classify(line, MessageLevel::StdOut));
+            }
+        }
+        QCOMPARE(levels, QList<MessageLevel::Enum>({ MessageLevel::Message, MessageLevel::Warning, MessageLevel::Error }));
+    }
+
+    void test_fromLine()
+    {
+        QString line = "!![Warning]!Something happened";
+        QCOMPARE(MessageLevel::fromLine(line), MessageLevel::Warning);
+        QCOMPARE(line, QString("Something happened"));
+        line = "[12:00:00] [main/INFO]: !![Error]!";
+        QCOMPARE(MessageLevel::fromLine(line), MessageLevel::Unknown);
+        QCOMPARE(line, QString("[12:00:00] [main/INFO]: !![Error]!"));
+    }
+
+    void benchmark_legacy()
+    {
+        QBENCHMARK
+        {
+            for (auto& line : m_lines) {
+                legacyGuessLevel(line, MessageLevel::StdOut);
+            }
+        }
+    }
+
+    void benchmark_classifier()
+    {
+        auto classifier = minecraftClassifier();
+        QBENCHMARK
+        {
+            for (auto& line : m_lines) {
+                classifier.classify(line, MessageLevel::StdOut);
+            }
+        }
+    }
+};
+
+QTEST_GUILESS_MAIN(LogLevelClassifierTest)
+
+#include "LogLevelClassifier_test.moc"
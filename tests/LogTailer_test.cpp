@@ -0,0 +1,141 @@
+#include <QDir>
+#include <QFile>
+#include <QSignalSpy>
+#include <QTemporaryDir>
+#include <QTest>
+
+#include <GZip.h>
+#include <launch/LogTailer.h>
+
+class LogTailerTest : public QObject {
+    Q_OBJECT
+
+    QTemporaryDir tempDir;
+
+    QString logPath() const { return tempDir.filePath("latest.log"); }
+
+    static bool writeFile(const QString& path, const QByteArray& data, QIODevice::OpenMode mode = QIODevice::Truncate)
+    {
+        QFile file(path);
+        return file.open(QIODevice::WriteOnly | mode) && file.write(data) == data.size();
+    }
+
+    static QStringList lines(QSignalSpy& spy)
+    {
+        QStringList out;
+        for (auto& args : spy) {
+            out += args.at(0).toStringList();
+        }
+        spy.clear();
+        return out;
+    }
+
+   private slots:
+    void init()
+    {
+        QVERIFY(tempDir.isValid());
+        QDir dir(tempDir.path());
+        for (auto& entry : dir.entryList(QDir::Files)) {
+            QVERIFY(dir.remove(entry));
+        }
+    }
+
+    void test_append()
+    {
+        QVERIFY(writeFile(logPath(), "one\ntwo\n"));
+        LogTailer tailer;
+        QSignalSpy appended(&tailer, &LogTailer::linesAppended);
+        QSignalSpy reset(&tailer, &LogTailer::reset);
+        tailer.setFileName(logPath());
+        tailer.start();
+        QCOMPARE(lines(appended), QStringList({ "one", "two" }));
+
+        QVERIFY(writeFile(logPath(), "three\nfou", QIODevice::Append));
+        tailer.poll();
+        QCOMPARE(lines(appended), QStringList({ "three" }));
+
+        QVERIFY(writeFile(logPath(), "r\r\n", QIODevice::Append));
+        tailer.poll();
+        QCOMPARE(lines(appended), QStringList({ "four" }));
+
+        tailer.poll();
+        QCOMPARE(appended.size(), 0);
+        QCOMPARE(reset.size(), 0);
+    }
+
+    void test_backlog()
+    {
+        QVERIFY(writeFile(logPath(), "aaaa\nbbbb\ncccc\n"));
+        LogTailer tailer;
+        QSignalSpy appended(&tailer, &LogTailer::linesAppended);
+        tailer.setFileName(logPath());
+        tailer.setInitialBacklog(7);
+        tailer.start();
+        // the cut off line is left out
+        QCOMPARE(lines(appended), QStringList({ "cccc" }));
+    }
+
+    void test_truncate()
+    {
+        QVERIFY(writeFile(logPath(), "one\ntwo\n"));
+        LogTailer tailer;
+        QSignalSpy appended(&tailer, &LogTailer::linesAppended);
+        QSignalSpy reset(&tailer, &LogTailer::reset);
+        tailer.setFileName(logPath());
+        tailer.start();
+        QCOMPARE(lines(appended), QStringList({ "one", "two" }));
+
+        QVERIFY(writeFile(logPath(), "new\n"));
+        tailer.poll();
+        QCOMPARE(reset.size(), 1);
+        QCOMPARE(lines(appended), QStringList({ "new" }));
+    }
+
+    void test_rotation()
+    {
+        QVERIFY(writeFile(logPath(), "one\ntwo\n"));
+        LogTailer tailer;
+        QSignalSpy appended(&tailer, &LogTailer::linesAppended);
+        QSignalSpy reset(&tailer, &LogTailer::reset);
+        tailer.setFileName(logPath());
+        tailer.start();
+        QCOMPARE(lines(appended), QStringList({ "one", "two" }));
+
+        // written after the last poll, right before the file is moved away
+        QVERIFY(writeFile(logPath(), "three\n", QIODevice::Append));
+        QVERIFY(QFile::rename(logPath(), tempDir.filePath("latest.log.1")));
+        QVERIFY(writeFile(logPath(), "four\n"));
+        tailer.poll();
+        QCOMPARE(lines(appended), QStringList({ "three", "four" }));
+        QCOMPARE(reset.size(), 0);
+
+        QVERIFY(writeFile(logPath(), "five\n", QIODevice::Append));
+        tailer.poll();
+        QCOMPARE(lines(appended), QStringList({ "five" }));
+    }
+
+    void test_gzipRotation()
+    {
+        QVERIFY(writeFile(logPath(), "one\ntwo\n"));
+        LogTailer tailer;
+        QSignalSpy appended(&tailer, &LogTailer::linesAppended);
+        QSignalSpy reset(&tailer, &LogTailer::reset);
+        tailer.setFileName(logPath());
+        tailer.start();
+        QCOMPARE(lines(appended), QStringList({ "one", "two" }));
+
+        // log4j compresses the old file and creates a new one, the last line of the old file may be unfinished
+        QByteArray compressed;
+        QVERIFY(GZip::zip("one\ntwo\nthree\nfou", compressed));
+        QVERIFY(writeFile(tempDir.filePath("2024-01-22-1.log.gz"), compressed));
+        QVERIFY(QFile::remove(logPath()));
+        QVERIFY(writeFile(logPath(), "new\n"));
+        tailer.poll();
+        QCOMPARE(lines(appended), QStringList({ "three", "fou", "new" }));
+        QCOMPARE(reset.size(), 0);
+    }
+};
+
+QTEST_GUILESS_MAIN(LogTailerTest)
+
+#include "LogTailer_test.moc"
@@ -82,6 +82,39 @@ class PackwizTest : public QObject {
         QCOMPARE(metadata.file_id, 3509043);
         QCOMPARE(metadata.project_id, 327154);
     }
+
+    void indexLookups()
+    {
+        QString source = QFINDTESTDATA("testdata/Packwiz");
+        QTemporaryDir temp_dir;
+        QVERIFY(temp_dir.isValid());
+
+        QDir index_dir(temp_dir.path());
+        auto files = QDir(source).entryList(QDir::Files);
+        for (auto& file : files)
+            QVERIFY(QFile::copy(QDir(source).absoluteFilePath(file), index_dir.absoluteFilePath(file)));
+
+        QCOMPARE(Packwiz::V1::getAllIndexes(index_dir).size(), files.size());
+
+        QVariant modrinth_id("kYq5qkSL");
+        auto metadata = Packwiz::V1::getIndexForMod(index_dir, modrinth_id);
+        QVERIFY(metadata.isValid());
+        QCOMPARE(metadata.name, "Borderless Mining");
+
+        QVariant flame_id(327154);
+        QCOMPARE(Packwiz::V1::getIndexForMod(index_dir, flame_id).name, "Screenshot to Clipboard (Fabric)");
+
+        // Changes made through the launcher are seen right away
+        metadata.name = "Borderless Mining (renamed)";
+        Packwiz::V1::updateModIndex(index_dir, metadata);
+        QCOMPARE(Packwiz::V1::getIndexForMod(index_dir, modrinth_id).name, "Borderless Mining (renamed)");
+        QCOMPARE(Packwiz::V1::getIndexForMod(index_dir, QString("borderless-mining")).name, "Borderless Mining (renamed)");
+
+        Packwiz::V1::deleteModIndex(index_dir, modrinth_id);
+        QVERIFY(!Packwiz::V1::getIndexForMod(index_dir, modrinth_id).isValid());
+        QVERIFY(!index_dir.exists("borderless-mining.pw.toml"));
+        QCOMPARE(Packwiz::V1::getAllIndexes(index_dir).size(), files.size() - 1);
+    }
 };
 
 QTEST_GUILESS_MAIN(PackwizTest)
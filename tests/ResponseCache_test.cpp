@@ -0,0 +1,91 @@
+#include <QDir>
+#include <QTemporaryDir>
+#include <QTest>
+
+#include <net/ResponseCache.h>
+
+class ResponseCacheTest : public QObject {
+    Q_OBJECT
+
+    QTemporaryDir tempDir;
+
+   private slots:
+    void initTestCase() { QVERIFY(tempDir.isValid()); }
+
+    void test_makeKey()
+    {
+        using Net::ResponseCache;
+
+        QCOMPARE(ResponseCache::makeKey(QUrl("https://api.modrinth.com/v2/search?query=sodium&limit=25&offset=0")),
+                 ResponseCache::makeKey(QUrl("https://api.modrinth.com/v2/search?offset=0&query=sodium&limit=25")));
+        QCOMPARE(ResponseCache::makeKey(QUrl("https://api.modrinth.com/v2/project/sodium/")),
+                 ResponseCache::makeKey(QUrl("https://api.modrinth.com/v2/project/sodium")));
+        QVERIFY(ResponseCache::makeKey(QUrl("https://api.modrinth.com/v2/search?query=sodium")) !=
+                ResponseCache::makeKey(QUrl("https://api.modrinth.com/v2/search?query=lithium")));
+
+        QUrl mods("https://api.curseforge.com/v1/mods");
+        QCOMPARE(ResponseCache::makeKey(mods, "{\"modIds\":[1]}"), ResponseCache::makeKey(mods, "{\"modIds\":[1]}"));
+        QVERIFY(ResponseCache::makeKey(mods, "{\"modIds\":[1]}") != ResponseCache::makeKey(mods, "{\"modIds\":[2]}"));
+        QVERIFY(ResponseCache::makeKey(mods, "{\"modIds\":[1]}") != ResponseCache::makeKey(mods));
+    }
+
+    void test_insertAndFind()
+    {
+        auto path = QDir(tempDir.path()).absoluteFilePath("insert");
+        auto key = Net::ResponseCache::makeKey(QUrl("https://api.modrinth.com/v2/project/sodium"));
+
+        {
+            Net::ResponseCache cache(path);
+            QVERIFY(!cache.find(key).has_value());
+
+            cache.insert(key, "{\"slug\":\"sodium\"}", "\"abc\"");
+            auto entry = cache.find(key);
+            QVERIFY(entry.has_value());
+            QCOMPARE(entry->data, QByteArray("{\"slug\":\"sodium\"}"));
+            QCOMPARE(entry->etag, QByteArray("\"abc\""));
+            QCOMPARE(cache.stats().misses, 1);
+        }
+
+        // a new cache picks the response up from the disk
+        Net::ResponseCache cache(path);
+        auto entry = cache.find(key);
+        QVERIFY(entry.has_value());
+        QCOMPARE(entry->data, QByteArray("{\"slug\":\"sodium\"}"));
+        QCOMPARE(entry->etag, QByteArray("\"abc\""));
+    }
+
+    void test_revalidate()
+    {
+        Net::ResponseCache cache(QDir(tempDir.path()).absoluteFilePath("revalidate"));
+        auto key = Net::ResponseCache::makeKey(QUrl("https://api.modrinth.com/v2/project/lithium"));
+
+        cache.insert(key, "lithium", "\"def\"");
+        auto fetched = cache.find(key)->fetched;
+
+        QTest::qWait(1100);
+        cache.revalidate(key);
+        QVERIFY(cache.find(key)->fetched > fetched);
+        QCOMPARE(cache.find(key)->data, QByteArray("lithium"));
+
+        cache.recordHit();
+        QCOMPARE(cache.stats().hits, 1);
+        QCOMPARE(cache.stats().revalidated, 1);
+        QCOMPARE(cache.stats().misses, 1);
+    }
+
+    void test_evictAll()
+    {
+        auto path = QDir(tempDir.path()).absoluteFilePath("evict");
+        Net::ResponseCache cache(path);
+        auto key = Net::ResponseCache::makeKey(QUrl("https://api.modrinth.com/v2/project/iris"));
+
+        cache.insert(key, "iris", {});
+        cache.evictAll();
+        QVERIFY(!cache.find(key).has_value());
+        QVERIFY(!QDir(path).exists());
+    }
+};
+
+QTEST_GUILESS_MAIN(ResponseCacheTest)
+
+#include "ResponseCache_test.moc"
@@ -0,0 +1,115 @@
+#include <QFile>
+#include <QSignalSpy>
+#include <QTemporaryDir>
+#include <QTest>
+
+#include <launch/LogModel.h>
+#include <launch/SessionLog.h>
+
+class SessionLogTest : public QObject {
+    Q_OBJECT
+
+    QTemporaryDir tempDir;
+
+    static QStringList texts(const QList<SessionLog::Line>& lines)
+    {
+        QStringList out;
+        for (auto& line : lines) {
+            out.append(line.text);
+        }
+        return out;
+    }
+
+    static QStringList rows(const LogModel& model)
+    {
+        QStringList out;
+        for (int i = 0; i < model.rowCount(); i++) {
+            out.append(model.data(model.index(i)).toString());
+        }
+        return out;
+    }
+
+   private slots:
+    void initTestCase() { QVERIFY(tempDir.isValid()); }
+
+    void test_read()
+    {
+        SessionLog log(tempDir.filePath("read.log.gz"));
+        for (int i = 0; i < 10; i++) {
+            log.append(i % 2 ? MessageLevel::Warning : MessageLevel::Info, QString("line %1").arg(i));
+        }
+        QCOMPARE(log.lineCount(), qint64(10));
+
+        auto lines = log.read(3, 4).result();
+        QCOMPARE(texts(lines), QStringList({ "line 3", "line 4", "line 5", "line 6" }));
+        QCOMPARE(lines[0].level, MessageLevel::Warning);
+        QCOMPARE(lines[1].level, MessageLevel::Info);
+
+        // lines appended after a read end up in a member of their own
+        log.append(MessageLevel::Error, "line 10");
+        lines = log.read(8, 10).result();
+        QCOMPARE(texts(lines), QStringList({ "line 8", "line 9", "line 10" }));
+        QCOMPARE(lines[2].level, MessageLevel::Error);
+
+        QVERIFY(log.read(11, 10).result().isEmpty());
+    }
+
+    void test_saveTo()
+    {
+        SessionLog log(tempDir.filePath("save.log.gz"));
+        log.append(MessageLevel::Info, "one");
+        log.append(MessageLevel::Error, "two");
+        auto target = tempDir.filePath("save.log");
+        QVERIFY(log.saveTo(target).result());
+        QFile file(target);
+        QVERIFY(file.open(QIODevice::ReadOnly));
+        QCOMPARE(file.readAll(), QByteArray("one\ntwo\n"));
+    }
+
+    void test_window()
+    {
+        LogModel model;
+        model.setMaxLines(3);
+        model.setSessionLog(new SessionLog(tempDir.filePath("window.log.gz"), &model));
+        for (int i = 0; i < 8; i++) {
+            model.append(MessageLevel::Info, QString::number(i));
+        }
+        QCOMPARE(rows(model), QStringList({ "5", "6", "7" }));
+        QVERIFY(model.isShowingLatest());
+        QVERIFY(model.canShowEarlier());
+
+        QSignalSpy moved(&model, &LogModel::windowChanged);
+        model.showEarlier();
+        QVERIFY(moved.wait());
+        QCOMPARE(rows(model), QStringList({ "2", "3", "4" }));
+        QVERIFY(!model.isShowingLatest());
+
+        // new lines don't move the window
+        model.append(MessageLevel::Info, "8");
+        QCOMPARE(rows(model), QStringList({ "2", "3", "4" }));
+
+        model.showEarlier();
+        QVERIFY(moved.wait());
+        QCOMPARE(rows(model), QStringList({ "0", "1" }));
+        QVERIFY(!model.canShowEarlier());
+
+        model.showLater();
+        QVERIFY(moved.wait());
+        QCOMPARE(rows(model), QStringList({ "2", "3", "4" }));
+
+        // the buffer has moved on by one line meanwhile, the page stops where it starts
+        model.showLater();
+        QVERIFY(moved.wait());
+        QCOMPARE(rows(model), QStringList({ "5" }));
+
+        moved.clear();
+        model.showLater();
+        QCOMPARE(moved.size(), 1);
+        QVERIFY(model.isShowingLatest());
+        QCOMPARE(rows(model), QStringList({ "6", "7", "8" }));
+    }
+};
+
+QTEST_GUILESS_MAIN(SessionLogTest)
+
+#include "SessionLog_test.moc"